@@ -202,6 +202,8 @@ int main(int argc, char* argv[])
   const int N = args.getValueOrFallback<int>("--resolution", 11);
   const int Re = args.getValueOrFallback<int>("--reynolds", 100);
   const int maxPhysT = args.getValueOrFallback<int>("--maxPhysT", 16);
+  const T refinementThreshold = args.getValueOrFallback<T>("--refinementThreshold", 1);
+  const T coarseningThreshold = args.getValueOrFallback<T>("--coarseningThreshold", 0.5);
 
   const UnitConverterFromResolutionAndRelaxationTime<T, DESCRIPTOR> converterLevel0(
     int {N},             // resolution: number of voxels per charPhysL
@@ -222,6 +224,10 @@ int main(int argc, char* argv[])
   cuboidDecompositionLevel0.splitFractional(3, 2, {0.1,0.8,0.1});
   cuboidDecompositionLevel0.splitFractional(5, 0, {0.5,0.5});
   cuboidDecompositionLevel0.splitFractional(7, 1, {0.5,0.5});
+  // Separate downstream core s.t. the wake may be refined adaptively
+  cuboidDecompositionLevel0.splitFractional(1, 1, {0.1,0.8,0.1});
+  cuboidDecompositionLevel0.splitFractional(9, 2, {0.1,0.8,0.1});
+  cuboidDecompositionLevel0.splitFractional(11, 0, {0.5,0.5});
   cuboidDecompositionLevel0.print();
 
   auto cuboidDecompositionLevel1 = cuboidDecompositionLevel0;
@@ -230,19 +236,9 @@ int main(int argc, char* argv[])
   cuboidDecompositionLevel1.refine(2);
   cuboidDecompositionLevel1.print();
 
-  // Adjust weights for balancing
-  for (int iC=0; iC < cuboidDecompositionLevel0.size(); ++iC) {
-    auto& cuboid = cuboidDecompositionLevel0.get(iC);
-    cuboid.setWeight(cuboid.getLatticeVolume());
-    auto origin = cuboidDecompositionLevel0.get(iC).getOrigin();
-    for (int jC=0; jC < cuboidDecompositionLevel1.size(); ++jC) {
-      if (cuboidDecompositionLevel1.get(jC).getOrigin() == origin) {
-        cuboid.setWeight(cuboid.getWeight() + 2*cuboidDecompositionLevel1.get(jC).getLatticeVolume());
-      }
-    }
-  }
-
-  HeuristicLoadBalancer<T> loadBalancerLevel0(cuboidDecompositionLevel0);
+  // Balance coarse cuboids by the work of their whole refinement subtree
+  HierarchicLoadBalancer<T,3> loadBalancerLevel0(cuboidDecompositionLevel0,
+                                                 {&cuboidDecompositionLevel1});
   SuperGeometry<T,3> sGeometryLevel0(cuboidDecompositionLevel0, loadBalancerLevel0);
   prepareGeometry(converterLevel0, sGeometryLevel0);
   SuperLattice<T,DESCRIPTOR> sLatticeLevel0(cuboidDecompositionLevel0,
@@ -251,51 +247,61 @@ int main(int argc, char* argv[])
                                             converterLevel0);
   prepareLattice(sLatticeLevel0, converterLevel0, sGeometryLevel0);
 
-  RefinedLoadBalancer<T,3> loadBalancerLevel1(cuboidDecompositionLevel0,
-                                              loadBalancerLevel0,
-                                              cuboidDecompositionLevel1);
   auto converterLevel1 = convectivelyRefineUnitConverter(converterLevel0, 2);
   converterLevel1.print();
-  SuperGeometry<T,3> sGeometryLevel1(cuboidDecompositionLevel1, loadBalancerLevel1);
-  prepareGeometryFine(converterLevel1, sGeometryLevel1);
-  SuperLattice<T,DESCRIPTOR> sLatticeLevel1(cuboidDecompositionLevel1,
-                                            loadBalancerLevel1,
-                                            3,
-                                            converterLevel1);
-  prepareLattice(sLatticeLevel1, converterLevel1, sGeometryLevel1);
 
-  auto coarseToFine = refinement::lagrava::makeCoarseToFineCoupler(
-    sLatticeLevel0, sGeometryLevel0,
-    sLatticeLevel1, sGeometryLevel1);
-  auto fineToCoarse = refinement::lagrava::makeFineToCoarseCoupler(
-    sLatticeLevel0, sGeometryLevel0,
-    sLatticeLevel1, sGeometryLevel1);
+  SuperLatticeHierarchy<T,DESCRIPTOR> hierarchy(sLatticeLevel0, sGeometryLevel0);
+  hierarchy.initialize();
 
-  coarseToFine->apply(meta::id<refinement::lagrava::InitializeO>{});
+  // Fine level follows the flow, cuboids around the sphere are always refined
+  SuperLatticeAdaptiveRefinement<T,DESCRIPTOR> adaptiveRefinement(hierarchy,
+    [&](SuperGeometry<T,3>& sGeometry, SuperLattice<T,DESCRIPTOR>& sLattice) {
+      prepareGeometryFine(converterLevel1, sGeometry);
+      prepareLattice(sLattice, converterLevel1, sGeometry);
+    });
+  std::set<int> sphereCuboids;
+  for (int iC=0; iC < cuboidDecompositionLevel0.size(); ++iC) {
+    for (int jC=0; jC < cuboidDecompositionLevel1.size(); ++jC) {
+      if (cuboidDecompositionLevel1.get(jC).getOrigin() == cuboidDecompositionLevel0.get(iC).getOrigin()) {
+        sphereCuboids.insert(iC);
+      }
+    }
+  }
+  adaptiveRefinement.setThresholds(refinementThreshold, coarseningThreshold);
+  adaptiveRefinement.setPersistent(sphereCuboids);
+  // Only cuboids away from the domain boundary are refinable
+  adaptiveRefinement.setRefinable([&](int iC) {
+    auto& cuboid = cuboidDecompositionLevel0.get(iC);
+    for (int iD=0; iD < 3; ++iD) {
+      const T min = cuboid.getOrigin()[iD];
+      const T max = min + cuboid.getExtent()[iD]*cuboid.getDeltaR();
+      if (min <= domainI.getMin()[iD] || max >= domainI.getMax()[iD]) {
+        return false;
+      }
+    }
+    return true;
+  });
+  adaptiveRefinement.refine(sphereCuboids);
 
   // === 4th Step: Main Loop with Timer ===
   clout << "starting simulation..." << std::endl;
   util::Timer<T> timer(converterLevel0.getLatticeTime(maxPhysT),
                            sGeometryLevel0.getStatistics().getNvoxel()
-                       + 2*sGeometryLevel1.getStatistics().getNvoxel());
+                       + 2*adaptiveRefinement.getGeometry().getStatistics().getNvoxel());
   timer.start();
 
   for (std::size_t iT = 0; iT < converterLevel0.getLatticeTime(maxPhysT); ++iT) {
     if (iT % converterLevel0.getLatticeTime(1.0) == 0) {
       writeResults(sLatticeLevel0, converterLevel0, iT, sGeometryLevel0, "level0");
-      writeResults(sLatticeLevel1, converterLevel1, iT, sGeometryLevel1, "level1");
+      writeResults(adaptiveRefinement.getLattice(), converterLevel1, iT,
+                   adaptiveRefinement.getGeometry(), "level1");
+    }
+    if (iT > 0 && iT % converterLevel0.getLatticeTime(0.5) == 0) {
+      adaptiveRefinement.adapt();
     }
 
     setBoundaryValues(sLatticeLevel0, converterLevel0, iT, sGeometryLevel0);
-    sLatticeLevel0.collideAndStream();
-
-    sLatticeLevel1.collideAndStream();
-    coarseToFine->apply(meta::id<refinement::lagrava::HalfTimeCoarseToFineO>{});
-
-    sLatticeLevel1.collideAndStream();
-    coarseToFine->apply(meta::id<refinement::lagrava::FullTimeCoarseToFineO>{});
-
-    fineToCoarse->apply(meta::id<refinement::lagrava::FineToCoarseO>{});
+    hierarchy.collideAndStream();
 
     if (iT % converterLevel0.getLatticeTime(0.1) == 0) {
       timer.update(iT);
@@ -308,4 +314,5 @@ int main(int argc, char* argv[])
 
   timer.stop();
   timer.printSummary();
+  hierarchy.printTimings();
 }
@@ -160,6 +160,8 @@ int main(int argc, char **argv)
   const std::size_t steps = args.getValueOrFallback<std::size_t>("--steps", 100);
   const std::size_t cuboidsPerProcess = args.getValueOrFallback<std::size_t>("--cuboids-per-process", 1);
   const bool exportResults = !args.contains("--no-results");
+  const bool autotune = args.contains("--autotune");
+  const bool roofline = args.contains("--roofline");
 
   if (exportResults) {
     singleton::directories().setOutputDir("./tmp/");
@@ -209,6 +211,18 @@ int main(int argc, char **argv)
     superLattice.collideAndStream();
   }
 
+  // Select fastest collision configuration per block (cached in ./tmp/autotuning.dat)
+  if (autotune) {
+    SuperLatticeAutotuner autotuner(superLattice);
+    autotuner.tune();
+  }
+
+  // Report collision performance w.r.t. measured bandwidth and peak FLOP/s (./tmp/roofline.json)
+  if (roofline) {
+    SuperLatticeRoofline report(superLattice);
+    report.write();
+  }
+
   #ifdef PLATFORM_GPU_CUDA
   gpu::cuda::device::synchronize();
   #endif
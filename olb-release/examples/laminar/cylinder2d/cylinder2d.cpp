@@ -269,8 +269,11 @@ void getResults( SuperLattice<T, DESCRIPTOR>& sLattice,
     {
       SuperEuklidNorm2D<T, DESCRIPTOR> normVel( velocity );
       BlockReduction2D2D<T> planeReduction( normVel, 600, BlockDataSyncMode::ReduceOnly );
-      // write output as JPEG
-      heatmap::write(planeReduction, iT);
+      // write output as PNG, colour mapping and encoding happen in the background
+      heatmap::plotParam<T> plotParam;
+      plotParam.png = true;
+      plotParam.background = true;
+      heatmap::write(planeReduction, iT, plotParam);
     }
   }
 
@@ -349,4 +352,7 @@ int main( int argc, char* argv[] )
 
   timer.stop();
   timer.printSummary();
+
+  // Flush heat maps still pending in the background
+  heatmap::waitForBackgroundOutput();
 }
@@ -29,12 +29,12 @@
  * 1. Provide or download a medium.
  *    For example: https://www.digitalrocksportal.org/projects/92
  * 2. Convert the TIFF series to VTI using ParaView
- *    (Point data are mandatory, cell data do not work)
  *     - Open TIFF series in ParaView
- *     - Apply "cell data to point data" filter (if it's grayed out, applying the filter isn't necessary)
  *     - Save the result as VTI
- *     - Use ASCII formatting
- *     - Solely export one array and use the name as an input when running the simulation (see <arrayname>)
+ *     - Use appended data mode without encoding and compression
+ *     - Use the name of the exported array as an input when running the simulation (see <arrayname>)
+ *    Alternatively, provide a NumPy .npy file of shape (nz,ny,nx) (<arrayname> is ignored)
+ *    Each process only reads the voxels intersecting its cuboids (see IndicatorVolume3D)
  * 3. Start the simulation with the following parameters (in that order):
  *    <filename> <arrayname> <scaling-factor> <time-scaling-factor> <resolution> <pressure_drop>
  *    Example: mpirun -np 6 ./resolvedRock3d rock.vti "Tiff Scalars" 2.5e-6 1.0 200 1.0
@@ -61,37 +61,25 @@ Vector<T, 3> extent;
 constexpr T fluidDensity       = 1000;
 constexpr T kinematicViscosity = 1e-6;
 
-// Rock geometry
-std::shared_ptr<BlockVTIreader3D<T, T>> vtiReader; // to ensure that the data persists
-
 // Results
 Vector<T, 3> currentAverageVelocity;
 T            currentPermeability;
 
-std::shared_ptr<IndicatorBlockData3D<T>>
-generateIndicatorFromVTI(const std::string vtiFile, const std::string arrayName)
+std::shared_ptr<IndicatorVolume3D<T>>
+generateIndicatorFromVolume(const std::string volumeFile, const std::string arrayName)
 {
   const T sourceScale = scalingFactor;
 
-  vtiReader = std::make_shared<BlockVTIreader3D<T, T>>(vtiFile, arrayName);
-
-  auto           cuboidSample     = vtiReader->getCuboid();
-  T              deltaRsample     = cuboidSample.getDeltaR() * sourceScale;
-  Vector<int, 3> extentSample     = cuboidSample.getExtent();
-  Vector<T, 3>   originSamplePhys = cuboidSample.getOrigin() * sourceScale;
-  Vector<T, 3>   extentSamplePhys = {deltaRsample * T(extentSample[0] + 0.5),
-                                     deltaRsample * T(extentSample[1] + 0.5),
-                                     deltaRsample * T(extentSample[2] + 0.5)};
+  // Only the header is read, voxels are loaded after decomposition
+  auto layout = volumeFile.ends_with(".npy") ? volume::readNPYLayout<T>(volumeFile)
+                                             : volume::readVTILayout<T>(volumeFile, arrayName);
+  layout.origin = layout.origin * sourceScale;
+  layout.deltaR = layout.deltaR * sourceScale;
   for (unsigned i = 0; i < 3; ++i) {
-    extent[i] = extentSamplePhys[i];
+    extent[i] = layout.deltaR * T(layout.extent[i] + 0.5);
   }
 
-
-  std::shared_ptr<IndicatorBlockData3D<T>> ind(
-      new IndicatorBlockData3D<T>(vtiReader->getBlockData(), extentSamplePhys,
-                                  originSamplePhys, deltaRsample, false));
-
-  return ind;
+  return std::make_shared<IndicatorVolume3D<T>>(layout);
 }
 
 void prepareGeometry(UnitConverter<T, DESCRIPTOR> const& converter,
@@ -328,8 +316,8 @@ int main(int argc, char* argv[])
   clout << "Array name: " << arrayName << std::endl;
   clout << "Pressure drop: " << pressureDrop << " Pa" << std::endl;
 
-  std::shared_ptr<IndicatorBlockData3D<T>> rock =
-      generateIndicatorFromVTI(vtiFile, arrayName);
+  std::shared_ptr<IndicatorVolume3D<T>> rock =
+      generateIndicatorFromVolume(vtiFile, arrayName);
   clout << "Rock x-length: " << extent[0] << " m" << std::endl;
   clout << "Rock y-length: " << extent[1] << " m" << std::endl;
   clout << "Rock z-length: " << extent[2] << " m" << std::endl;
@@ -368,13 +356,18 @@ int main(int argc, char* argv[])
   //layer of 1 cell around the rock geometry for correct definition of bondary matreial numbers
   IndicatorLayer3D<T> layer(*rock, converter.getPhysDeltaX());
 
+  // Voxels are only available after decomposition, i.e. decompose the bounding box
+  IndicatorCuboid3D<T> bounds(layer.getMax() - layer.getMin(), layer.getMin());
   CuboidDecomposition3D<T> cuboidDecomposition(
-      layer, converter.getPhysDeltaX(), noOfCuboids);
+      bounds, converter.getPhysDeltaX(), noOfCuboids);
   cuboidDecomposition.setPeriodicity({false, true, true});
 
   // Instantiation of a loadBalancer
   HeuristicLoadBalancer<T> loadBalancer(cuboidDecomposition);
 
+  // Read the voxels of the local cuboids
+  rock->load(cuboidDecomposition, loadBalancer);
+
   // Instantiation of a superGeometry
   SuperGeometry<T, 3> superGeometry(cuboidDecomposition, loadBalancer);
 
@@ -266,6 +266,9 @@ int main(int argc, char *argv[])
     converter.getLatticeTemperature(Tcold));
   coupling.setParameter<NavierStokesAdvectionDiffusionCoupling::FORCE_PREFACTOR>(
     boussinesqForcePrefactor * Vector<T,3>{0.0,1.0,0.0});
+  // Apply the coupling within the collision loop of ADlattice instead of in a
+  // separate pass, i.e. after NSlattice was updated in the previous step
+  coupling.fuseIntoCollision(names::Temperature{});
 
   /// === 4th Step: Main Loop with Timer ===
   util::Timer<T> timer(converter.getLatticeTime(maxPhysT), superGeometry.getStatistics().getNvoxel() );
@@ -287,8 +290,6 @@ int main(int argc, char *argv[])
     ADlattice.collideAndStream();
     NSlattice.collideAndStream();
 
-    coupling.execute();
-
     /// === 7th Step: Computation and Output of the Results ===
     getResults(converter, NSlattice, ADlattice, iT, superGeometry, timer, converge.hasConverged());
     converge.takeValue(ADlattice.getStatistics().getAverageEnergy(),true);
@@ -40,7 +40,11 @@ using namespace olb::descriptors;
 using namespace olb::util;
 
 using T = FLOATING_POINT_TYPE;
-using DESCRIPTOR = D3Q19<FORCE,TENSOR,VELOCITY,POROSITY,VELOCITY2,AVERAGE_VELOCITY>;
+using DESCRIPTOR = D3Q19<FORCE,TENSOR,VELOCITY,POROSITY,VELOCITY2,AVERAGE_VELOCITY,
+                         statistics::SAMPLES,
+                         statistics::MEAN<statistics::Velocity>,
+                         statistics::M2<statistics::Velocity>,
+                         statistics::M3<statistics::Velocity>>;
 
 //#define HRR_COLLISION
 
@@ -238,6 +242,9 @@ void prepareLattice(SuperLattice<T,DESCRIPTOR>& sLattice,
   AnalyticalConst3D<T, T> hybrid(hybridConst);
   sLattice.defineField<collision::HYBRID>(superGeometry, 1, hybrid);
 #endif
+  // Accumulate velocity statistics (Reynolds stresses) alongside the regular step
+  sLattice.addPostProcessor<stage::PostStream>(superGeometry.getMaterialIndicator({1}),
+                                               meta::id<RunningStatisticsO<statistics::Velocity>>{});
 
   /// Material = 2 --> boundary node + wallfunction
 
@@ -285,6 +292,9 @@ void getResults(SuperLattice<T, DESCRIPTOR>& sLattice,
   if (iT == iTstartAvg) {
     SuperLatticeVelocity3D<T,DESCRIPTOR> latticeVelocity(sLattice);
     sLattice.defineField<descriptors::AVERAGE_VELOCITY>(superGeometry.getMaterialIndicator({1,2}), latticeVelocity);
+    // Restart running statistics once the flow is developed
+    AnalyticalConst3D<T,T> zero(0);
+    sLattice.defineField<statistics::SAMPLES>(superGeometry.getMaterialIndicator({1}), zero);
   }
   if (iT < iTstartAvg) {
     sLattice.setParameter<descriptors::LATTICE_TIME>(2);
@@ -305,12 +315,18 @@ void getResults(SuperLattice<T, DESCRIPTOR>& sLattice,
       SuperLatticePhysField3D<T,DESCRIPTOR,AVERAGE_VELOCITY> sAveragedVel(sLattice, converter.getConversionFactorVelocity());
       SuperLatticePhysField3D<T,DESCRIPTOR,descriptors::WMVELOCITY> wmvelocity(sLattice, converter.getConversionFactorVelocity());
       wmvelocity.getName() = "wmvelocity";
+      SuperLatticeRunningCovariance3D<T,DESCRIPTOR,statistics::Velocity> reynoldsStress(
+        sLattice, converter.getConversionFactorVelocity()*converter.getConversionFactorVelocity());
+      reynoldsStress.getName() = "reynoldsStress";
+      SuperLatticeRunningSkewness3D<T,DESCRIPTOR,statistics::Velocity> skewness(sLattice);
       SuperGeometryF<T,3> geom(superGeometry);
       vtmWriter.addFunctor(velocity);
       vtmWriter.addFunctor(pressure);
       vtmWriter.addFunctor(sAveragedVel);
       vtmWriter.addFunctor(geom);
       vtmWriter.addFunctor(wmvelocity);
+      vtmWriter.addFunctor(reynoldsStress);
+      vtmWriter.addFunctor(skewness);
       task(vtmWriter, iT);
     });
 
@@ -126,17 +126,21 @@ int main( int argc, char* argv[] )
   IndicatorCuboid2D<T> cuboid( extend, origin );
 
 #ifdef PARALLEL_MODE_MPI
-  CuboidDecomposition2D<T> cuboidDecomposition( cuboid, 1.0 / resolution, singleton::mpi().getSize() );
+  const int noOfCuboids = singleton::mpi().getSize();
 #else
-  CuboidDecomposition2D<T> cuboidDecomposition( cuboid, 1.0 / resolution, 1 );
+  const int noOfCuboids = 1;
 #endif
+  CuboidDecomposition2D<T> cuboidDecomposition( cuboid, 1.0 / resolution, noOfCuboids );
 
   HeuristicLoadBalancer<T> loadBalancer( cuboidDecomposition );
   SuperGeometry<T,2> superGeometry( cuboidDecomposition, loadBalancer );
 
   clout << "Starting simulation over " << samples.size() << " samples." << std::endl;
 
-  for(int n = 0; n < samples.size(); ++n) {
+  // Samples are distributed dynamically over groups of processes, the small
+  // lattice of this case is simulated by a single process per sample
+  EnsembleRunner<T> ensemble(uq, singleton::mpi().getSize());
+  auto& statistics = ensemble.run([&](std::size_t n, const std::vector<T>& sample) {
     // Create subfolder for this sample
     std::string subFoldPath = foldPath + std::to_string(n) + "/tmp/";
     createDirectory(subFoldPath, clout);
@@ -144,8 +148,11 @@ int main( int argc, char* argv[] )
     singleton::directories().setOutputDir(subFoldPath);
 
     // Run the cavity2d simulation for this particular sample
-    simulateCavity2d(samples[n][0], resolution, n);
-  }
+    return simulateCavity2d(sample[0], resolution, n, noOfCuboids);
+  });
+
+  clout << "Average energy: mean = " << statistics.mean(0)
+        << ", std = " << statistics.std(0) << std::endl;
 
   // === 6. Post-processing: compute mean, std, and write VTI data ===
   // The string "physVelocity" is a tag used inside the function, not the variable name.
@@ -163,7 +163,7 @@ void getResults( SuperLattice<T, DESCRIPTOR>& sLattice,
   }
 }
 
-void simulateCavity2d(T physVelocity, int N, int idx)
+std::vector<T> simulateCavity2d(T physVelocity, int N, int idx, int noOfCuboids)
 {
 
   // === 1st Step: Initialization ===
@@ -188,11 +188,8 @@ void simulateCavity2d(T physVelocity, int N, int idx)
   Vector<T,2> origin( 0,0 );
   IndicatorCuboid2D<T> cuboid( extend, origin );
 
-#ifdef PARALLEL_MODE_MPI
-  CuboidDecomposition2D<T> cuboidDecomposition( cuboid, 1.0 / N, singleton::mpi().getSize() );
-#else
-  CuboidDecomposition2D<T> cuboidDecomposition( cuboid, 1.0 / N, 1 );
-#endif
+  // Independent of the processes simulating this sample to match the decomposition of the post-processing
+  CuboidDecomposition2D<T> cuboidDecomposition( cuboid, 1.0 / N, noOfCuboids );
 
   cuboidDecomposition.print();
 
@@ -244,4 +241,7 @@ void simulateCavity2d(T physVelocity, int N, int idx)
 
   timer.stop();
   timer.printSummary();
+
+  // Quantity of interest: average kinetic energy of the final state
+  return { sLattice.getStatistics().getAverageEnergy() };
 }
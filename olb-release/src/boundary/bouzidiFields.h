@@ -29,7 +29,7 @@ namespace olb {
 namespace descriptors {
 
 /// Interpolated Bounce Back (Bouzidi) distance field
-struct BOUZIDI_DISTANCE : public descriptors::FIELD_BASE<0,0,1> {
+struct BOUZIDI_DISTANCE : public descriptors::SPARSE_FIELD_BASE<0,0,1> {
   template <typename T, typename DESCRIPTOR>
   static constexpr auto getInitialValue() {
     return Vector<value_type<T>,DESCRIPTOR::template size<BOUZIDI_DISTANCE>()>(-1);
@@ -37,12 +37,13 @@ struct BOUZIDI_DISTANCE : public descriptors::FIELD_BASE<0,0,1> {
 };
 
 /// Interpolated Bounce Back (Bouzidi) velocity coefficient field
-struct BOUZIDI_VELOCITY : public descriptors::FIELD_BASE<0,0,1> { };
+struct BOUZIDI_VELOCITY : public descriptors::SPARSE_FIELD_BASE<0,0,1> { };
 
 /// Interpolated Bounce Back (Bouzidi) for ADE Dirichlet field
-struct BOUZIDI_ADE_DIRICHLET : public descriptors::FIELD_BASE<0,0,1> { };
+struct BOUZIDI_ADE_DIRICHLET : public descriptors::SPARSE_FIELD_BASE<0,0,1> { };
 
-struct NORMAL : public descriptors::FIELD_BASE<0,1,0> { };
+/// Boundary normal of Bouzidi cells
+struct NORMAL : public descriptors::SPARSE_FIELD_BASE<0,1,0> { };
 
 struct BOUZIDI_NORMAL : public FIELD_BASE_CUSTOM_SIZE {
   template <unsigned D, unsigned Q >
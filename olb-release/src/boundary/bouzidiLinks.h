@@ -0,0 +1,287 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef BOUZIDI_LINKS_H
+#define BOUZIDI_LINKS_H
+
+#include "bouzidiFields.h"
+#include "core/blockLattice.h"
+
+namespace olb {
+
+class BouzidiPostProcessor;
+class BouzidiVelocityPostProcessor;
+
+/// Interpolated bounce back links of a block, compiled from BOUZIDI_DISTANCE
+/**
+ * Each link of a boundary cell x_b in direction iPop reconstructs the missing
+ * population opposite to iPop. Links are grouped by direction and q-regime
+ * (full-way bounce back for q = 0, cut closer to the fluid cell for q <= 0.5
+ * and closer to the solid cell otherwise). Interpolation coefficients are
+ * precomputed such that each group is applied by a branch-free loop using
+ * fixed population columns and neighbor distances.
+ *
+ * Directions are processed in ascending order and links of each group by cell
+ * ID. Results of fluid cells match the cell-wise application exactly. Only
+ * boundary cells whose solid side neighbor is a boundary cell itself (e.g. at
+ * inlets next to the wall) may see a different update order.
+ *
+ * The links are not serialized and compiled on first use after the set of
+ * cells changed or invalidate() was called.
+ **/
+template <typename T, typename DESCRIPTOR>
+class BouzidiLinksD final : public Serializable {
+public:
+  /// q-regimes of links
+  enum Regime : unsigned {
+    BounceBack = 0,
+    Fluid      = 1,
+    Solid      = 2
+  };
+
+  /// Links of a single direction and regime
+  struct Group {
+    std::vector<CellID> cells;
+    /// Coefficients of solid side and fluid side populations
+    std::vector<T> a;
+    std::vector<T> b;
+    /// Coefficient of the wall velocity term
+    std::vector<T> c;
+
+    void clear() {
+      cells.clear();
+      a.clear();
+      b.clear();
+      c.clear();
+    }
+    void add(CellID iCell, T aI, T bI, T cI) {
+      cells.emplace_back(iCell);
+      a.emplace_back(aI);
+      b.emplace_back(bI);
+      c.emplace_back(cI);
+    }
+  };
+
+private:
+  /// Cells scheduled for link application, sorted and unique once compiled
+  std::vector<CellID> _cells;
+  std::array<std::array<Group,3>,DESCRIPTOR::q> _groups;
+  bool _valid;
+
+public:
+  BouzidiLinksD(std::size_t):
+    _valid(false)
+  { }
+
+  BouzidiLinksD& asAbstract() {
+    return *this;
+  }
+
+  /// Schedule links of iCell
+  void add(CellID iCell) {
+    _cells.emplace_back(iCell);
+    _valid = false;
+  }
+
+  bool empty() const {
+    return _cells.empty();
+  }
+
+  bool isValid() const {
+    return _valid;
+  }
+  /// Trigger recompilation e.g. after external changes of BOUZIDI_DISTANCE
+  void invalidate() {
+    _valid = false;
+  }
+
+  const Group& getGroup(int iPop, Regime regime) const {
+    return _groups[iPop][regime];
+  }
+
+  /// Compile links of all scheduled cells from BOUZIDI_DISTANCE
+  template <typename BLOCK>
+  void compile(BLOCK& block)
+  {
+    std::sort(_cells.begin(), _cells.end());
+    _cells.erase(std::unique(_cells.begin(), _cells.end()), _cells.end());
+    for (auto& groups : _groups) {
+      for (auto& group : groups) {
+        group.clear();
+      }
+    }
+    const auto& q = block.template getField<descriptors::BOUZIDI_DISTANCE>();
+    for (CellID iCell : _cells) {
+      for (int iPop=1; iPop < DESCRIPTOR::q; ++iPop) {
+        const T qI = q[iPop][iCell];
+        if (qI > T{0}) {
+          if (qI <= T{0.5}) {
+            _groups[iPop][Fluid].add(iCell, T{2} * qI, T{1} - T{2} * qI, T{2});
+          } else {
+            _groups[iPop][Solid].add(iCell, T{0.5} / qI, T{0.5} * (T{2} * qI - T{1}) / qI, T{1} / qI);
+          }
+        } else if (qI == T{0}) {
+          _groups[iPop][BounceBack].add(iCell, T{0}, T{1}, T{2});
+        }
+      }
+    }
+    _valid = true;
+  }
+
+  void setProcessingContext(ProcessingContext) { }
+
+  std::size_t getNblock() const override {
+    return 0;
+  }
+  std::size_t getSerializableSize() const override {
+    return 0;
+  }
+  bool* getBlock(std::size_t iBlock, std::size_t& sizeBlock, bool loadingMode) override {
+    return nullptr;
+  }
+
+};
+
+/// Describe BouzidiLinksD of OPERATOR in Data
+template <typename OPERATOR>
+struct BouzidiLinks {
+  template <typename T, typename DESCRIPTOR, Platform PLATFORM>
+  using type = BouzidiLinksD<T,DESCRIPTOR>;
+};
+
+/// Applies the cell-wise Bouzidi OPERATOR to the BouzidiLinks of a block
+/**
+ * Supported are BouzidiPostProcessor and BouzidiVelocityPostProcessor. The
+ * wall velocity coefficients are read in each application as they may be
+ * updated by setBouzidiVelocity at any time.
+ **/
+template <typename OPERATOR>
+struct BouzidiLinksO {
+  static constexpr OperatorScope scope = OperatorScope::PerBlock;
+
+  static constexpr bool velocity = std::is_same_v<OPERATOR,BouzidiVelocityPostProcessor>;
+  /// True iff OPERATOR can be applied to link lists
+  static constexpr bool supported = std::is_same_v<OPERATOR,BouzidiPostProcessor> || velocity;
+
+  int getPriority() const {
+    return OPERATOR().getPriority();
+  }
+
+  template <typename BLOCK>
+  void setup(BLOCK& block) { }
+
+  template <typename BLOCK>
+  void apply(BLOCK& block)
+  {
+    if constexpr (supported && isPlatformCPU(BLOCK::platform)) {
+      auto& links = block.template getData<BouzidiLinks<OPERATOR>>();
+      if (!links.isValid()) {
+        links.compile(block);
+      }
+      if constexpr (velocity) {
+        const auto& u = block.template getField<descriptors::BOUZIDI_VELOCITY>();
+        apply(block, links, [&](int iPop, CellID iCell) {
+          return u[iPop][iCell];
+        });
+      } else {
+        apply(block, links, [](int, CellID) {
+          return 0;
+        });
+      }
+    } else {
+      throw std::runtime_error("BouzidiLinks are only supported on CPU platforms");
+    }
+  }
+
+  template <typename BLOCK, typename LINKS, typename VELOCITY>
+  void apply(BLOCK& block, const LINKS& links, VELOCITY velocityCoefficient)
+  {
+    using V = typename BLOCK::value_t;
+    using DESCRIPTOR = typename BLOCK::descriptor_t;
+    using Regime = typename LINKS::Regime;
+    auto& f = block.template getField<descriptors::POPULATION>();
+
+    #ifdef PARALLEL_MODE_OMP
+    #pragma omp parallel
+    #endif
+    for (int iPop=1; iPop < DESCRIPTOR::q; ++iPop) {
+      const int iPop_opposite = descriptors::opposite<DESCRIPTOR>(iPop);
+      const CellDistance d = block.getNeighborDistance(descriptors::c<DESCRIPTOR>(iPop));
+      auto& f_i = f[iPop];
+      auto& f_opp = f[iPop_opposite];
+      auto veloTerm = [&](CellID iCell) -> V {
+        return velocityCoefficient(iPop, iCell) * (descriptors::t<V,DESCRIPTOR>(iPop)) * (descriptors::invCs2<V,DESCRIPTOR>());
+      };
+
+      {
+        // Intersection point is on the cell, full-way bounce back
+        const auto& group = links.getGroup(iPop, Regime::BounceBack);
+        #ifdef PARALLEL_MODE_OMP
+        #pragma omp for schedule(static)
+        #endif
+        for (std::size_t i=0; i < group.cells.size(); ++i) {
+          const CellID x_b = group.cells[i];
+          if constexpr (velocity) {
+            f_opp[x_b] = f_i[x_b] - V{2} * veloTerm(x_b);
+          } else {
+            f_opp[x_b] = f_i[x_b];
+          }
+        }
+      }
+      {
+        // Cut is closer to the fluid cell, interpolate between x_s and x_b
+        const auto& group = links.getGroup(iPop, Regime::Fluid);
+        #ifdef PARALLEL_MODE_OMP
+        #pragma omp for schedule(static)
+        #endif
+        for (std::size_t i=0; i < group.cells.size(); ++i) {
+          const CellID x_b = group.cells[i];
+          if constexpr (velocity) {
+            f_opp[x_b] = group.a[i] * f_i[x_b + d] + group.b[i] * f_i[x_b] - group.c[i] * veloTerm(x_b);
+          } else {
+            f_opp[x_b] = group.a[i] * f_i[x_b + d] + group.b[i] * f_i[x_b];
+          }
+        }
+      }
+      {
+        // Cut is closer to the solid cell, interpolate between x_s and x_f
+        const auto& group = links.getGroup(iPop, Regime::Solid);
+        #ifdef PARALLEL_MODE_OMP
+        #pragma omp for schedule(static)
+        #endif
+        for (std::size_t i=0; i < group.cells.size(); ++i) {
+          const CellID x_b = group.cells[i];
+          if constexpr (velocity) {
+            f_opp[x_b] = group.a[i] * f_i[x_b + d] + group.b[i] * f_opp[x_b - d] - group.c[i] * veloTerm(x_b);
+          } else {
+            f_opp[x_b] = group.a[i] * f_i[x_b + d] + group.b[i] * f_opp[x_b - d];
+          }
+        }
+      }
+    }
+  }
+};
+
+}
+
+#endif
@@ -25,6 +25,7 @@
 #define SET_BOUZIDI_BOUNDARY_H
 
 #include "bouzidiFields.h"
+#include "bouzidiLinks.h"
 #include "postprocessor/bouzidiSlipVelocityPostProcessor3D.h"
 #include "postprocessor/bouzidiTemperatureJumpPostProcessor3D.h"
 #include "setBoundary2D.h"
@@ -239,6 +240,22 @@ void setBouzidiBoundary(BlockLattice<T,DESCRIPTOR>& block,
   clout.setMultiOutput(true);
 
   const T deltaR = blockGeometry.getDeltaR();
+
+  // CPU blocks apply supported operators to precompiled link lists instead of cell-wise
+  const bool useLinks = BouzidiLinksO<OPERATOR>::supported && isPlatformCPU(block.getPlatform());
+  auto addBoundaryCell = [&](LatticeR<DESCRIPTOR::d> latticeR) {
+    if (block.isPadding(latticeR)) {
+      return;
+    }
+    if constexpr (BouzidiLinksO<OPERATOR>::supported) {
+      if (useLinks) {
+        block.template getData<BouzidiLinks<OPERATOR>>().add(block.getCellId(latticeR));
+        return;
+      }
+    }
+    block.addPostProcessor(typeid(stage::PostStream), latticeR, meta::id<OPERATOR>{});
+  };
+
   // for each solid cell: all of its fluid neighbors need population updates
   block.forSpatialLocations([&](LatticeR<DESCRIPTOR::d> solidLatticeR) {
     // Check if cell is solid cell
@@ -303,11 +320,7 @@ void setBouzidiBoundary(BlockLattice<T,DESCRIPTOR>& block,
                 block.get(boundaryLatticeR).template setFieldComponent<descriptors::BOUZIDI_ADE_DIRICHLET>(iPop_opposite, 0);
               }
               // Setting up the post processor, if this cell does not have one yet.
-              if (!block.isPadding(boundaryLatticeR)) {
-                block.addPostProcessor(typeid(stage::PostStream),
-                                      boundaryLatticeR,
-                                      meta::id<OPERATOR>{});
-              }
+              addBoundaryCell(boundaryLatticeR);
             }
           }
           // if neigbour cell is not fluid
@@ -324,17 +337,19 @@ void setBouzidiBoundary(BlockLattice<T,DESCRIPTOR>& block,
               if constexpr (std::is_same_v<OPERATOR, BouzidiAdeDirichletPostProcessor>) {
                 block.get(boundaryLatticeR).template setFieldComponent<descriptors::BOUZIDI_ADE_DIRICHLET>(iPop_opposite, 0);
               }
-              if (!block.isPadding(boundaryLatticeR)) {
-                block.addPostProcessor(typeid(stage::PostStream),
-                                      boundaryLatticeR,
-                                      meta::id<OPERATOR>{});
-              }
+              addBoundaryCell(boundaryLatticeR);
             }
           }
         }
       }
     }
   });
+
+  if constexpr (BouzidiLinksO<OPERATOR>::supported) {
+    if (useLinks && !block.template getData<BouzidiLinks<OPERATOR>>().empty()) {
+      block.addPostProcessor(typeid(stage::PostStream), meta::id<BouzidiLinksO<OPERATOR>>{});
+    }
+  }
 }
 
 /// Set Bouzidi velocity boundary on material cells of sLattice
@@ -33,6 +33,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 
 namespace olb {
 
@@ -61,13 +62,35 @@ private:
   std::map<int, std::vector<CellID>> _cellsOutboundTo;
   std::map<int, std::vector<CellID>> _cellsRequestedFrom;
 
+  /// Field communicated only for the requested components of each cell
+  std::optional<std::type_index> _componentField;
+  unsigned _componentCount = 0;
+  /// Bit mask of requested components for each cell in _cellsRequestedFrom
+  std::map<int, std::vector<std::uint32_t>> _componentsRequestedFrom;
+  /// Bit mask of requested components for each cell in _cellsOutboundTo
+  std::map<int, std::vector<std::uint32_t>> _componentsOutboundTo;
+
+  /// Cells to be communicated for each component of _componentField
+  std::map<int, std::vector<std::vector<CellID>>> _componentCellsInboundFrom;
+  std::map<int, std::vector<std::vector<CellID>>> _componentCellsOutboundTo;
+  std::map<int, std::vector<std::vector<CellID>>> _componentCellsRequestedFrom;
+
 #ifdef PARALLEL_MODE_MPI
   MPI_Comm _neighborhoodComm;
 
   std::map<int, std::unique_ptr<MpiSendRequest>> _fieldRequests;
   std::map<int, std::unique_ptr<MpiSendRequest>> _cellsRequests;
+  std::map<int, std::unique_ptr<MpiSendRequest>> _componentsRequests;
 #endif
 
+  /// Request individual cell for communication of the given components
+  void requestCell(LatticeR<D> latticeR, std::uint32_t components);
+  /// Distribute cells to lists of the components they are requested for
+  static void sortByComponent(const std::vector<CellID>& cells,
+                              const std::vector<std::uint32_t>& components,
+                              unsigned nComponents,
+                              std::vector<std::vector<CellID>>& cellsOfComponent);
+
 public:
   BlockCommunicationNeighborhood(  CuboidDecomposition<T,D>& cuboidDecomposition
                                  , LoadBalancer<T>& loadBalancer
@@ -92,6 +115,15 @@ public:
   void requestOverlap(int width);
   /// Request all indicated cells in overlap of width for communication
   void requestOverlap(int width, BlockIndicatorF<T,D>& indicatorF);
+  /// Request only the components of field propagating from the overlap into the core
+  /**
+   * Component iD of an overlap cell x is communicated iff x + velocities[iD]
+   * is a core cell, e.g. only the populations streaming into the block.
+   * Cells that are additionally requested by other means still communicate
+   * all components of field.
+   **/
+  void requestPropagation(std::type_index field,
+                          const std::vector<LatticeR<D>>& velocities);
 
   /// Remove all requested cells
   void clearRequestedCells();
@@ -127,6 +159,16 @@ public:
   const std::vector<CellID>& getCellsInboundFrom(int iC) const;
   const std::vector<CellID>& getCellsRequestedFrom(int iC) const;
 
+  /// Returns field that is communicated component-wise, if any
+  const std::optional<std::type_index>& getComponentField() const {
+    return _componentField;
+  }
+
+  /// Cells per component of getComponentField, ordered as in getCells*(iC)
+  const std::vector<std::vector<CellID>>& getComponentCellsOutboundTo(int iC) const;
+  const std::vector<std::vector<CellID>>& getComponentCellsInboundFrom(int iC) const;
+  const std::vector<std::vector<CellID>>& getComponentCellsRequestedFrom(int iC) const;
+
 };
 
 // *INDENT-ON*
@@ -61,10 +61,19 @@ BlockCommunicationNeighborhood<T,D>::BlockCommunicationNeighborhood(
   for (auto& [_, cells] : _cellsRequestedFrom) {
     cells.clear();
   }
+  for (auto& [_, components] : _componentsRequestedFrom) {
+    components.clear();
+  }
 }
 
 template <typename T, unsigned D>
 void BlockCommunicationNeighborhood<T,D>::requestCell(LatticeR<D> latticeR)
+{
+  requestCell(latticeR, ~std::uint32_t{0});
+}
+
+template <typename T, unsigned D>
+void BlockCommunicationNeighborhood<T,D>::requestCell(LatticeR<D> latticeR, std::uint32_t components)
 {
   const auto& cuboid = _cuboidDecomposition.get(_iC);
   BlockStructureD<D> paddedBlock(cuboid.getExtent(), _padding);
@@ -80,6 +89,7 @@ void BlockCommunicationNeighborhood<T,D>::requestCell(LatticeR<D> latticeR)
 
       _cellsRequestedFrom[(*remoteLatticeR)[0]].emplace_back(
         remotePaddedBlock.getCellId(&(*remoteLatticeR)[1]));
+      _componentsRequestedFrom[(*remoteLatticeR)[0]].emplace_back(components);
     }
   } else {
     throw std::logic_error("Requested cell is outside of available padding");
@@ -126,12 +136,75 @@ void BlockCommunicationNeighborhood<T,D>::requestOverlap(int width, BlockIndicat
   });
 }
 
+template <typename T, unsigned D>
+void BlockCommunicationNeighborhood<T,D>::requestPropagation(std::type_index field,
+                                                             const std::vector<LatticeR<D>>& velocities)
+{
+  if (velocities.size() > 8*sizeof(std::uint32_t)) {
+    throw std::logic_error("Component-wise communication is limited to 32 components");
+  }
+  if (_componentField && (*_componentField != field || _componentCount != velocities.size())) {
+    throw std::logic_error("Only a single field may be communicated component-wise");
+  }
+  _componentField = field;
+  _componentCount = velocities.size();
+
+  int width = 1;
+  for (const auto& c : velocities) {
+    for (unsigned iD=0; iD < D; ++iD) {
+      width = std::max(width, std::abs(c[iD]));
+    }
+  }
+  if (width > _padding) {
+    throw std::logic_error("Requested propagation exceeds available padding");
+  }
+
+  const auto& cuboid = _cuboidDecomposition.get(_iC);
+  BlockStructureD<D> overlapBlock(cuboid.getExtent(), width);
+
+  overlapBlock.forSpatialLocations([&](LatticeR<D> latticeR) {
+    if (overlapBlock.isPadding(latticeR)) {
+      std::uint32_t components = 0;
+      for (unsigned iComponent=0; iComponent < velocities.size(); ++iComponent) {
+        if (overlapBlock.isInsideCore(latticeR + velocities[iComponent])) {
+          components |= std::uint32_t{1} << iComponent;
+        }
+      }
+      if (components != 0) {
+        requestCell(latticeR, components);
+      }
+    }
+  });
+}
+
 template <typename T, unsigned D>
 void BlockCommunicationNeighborhood<T,D>::clearRequestedCells()
 {
   _cellsInboundFrom.clear();
   _cellsOutboundTo.clear();
   _cellsRequestedFrom.clear();
+  _componentsRequestedFrom.clear();
+  _componentsOutboundTo.clear();
+  _componentCellsInboundFrom.clear();
+  _componentCellsOutboundTo.clear();
+  _componentCellsRequestedFrom.clear();
+}
+
+template <typename T, unsigned D>
+void BlockCommunicationNeighborhood<T,D>::sortByComponent(const std::vector<CellID>& cells,
+                                                          const std::vector<std::uint32_t>& components,
+                                                          unsigned nComponents,
+                                                          std::vector<std::vector<CellID>>& cellsOfComponent)
+{
+  cellsOfComponent.clear();
+  cellsOfComponent.resize(nComponents);
+  for (std::size_t i=0; i < cells.size(); ++i) {
+    for (unsigned iComponent=0; iComponent < nComponents; ++iComponent) {
+      if (components[i] & (std::uint32_t{1} << iComponent)) {
+        cellsOfComponent[iComponent].emplace_back(cells[i]);
+      }
+    }
+  }
 }
 
 template <typename T, unsigned D>
@@ -163,23 +236,31 @@ void BlockCommunicationNeighborhood<T,D>::maintain()
   for (auto& [iC, _] : _cellsInboundFrom) {
     auto& iCells = _cellsInboundFrom[iC];
     auto& oCells = _cellsRequestedFrom[iC];
+    auto& oComponents = _componentsRequestedFrom[iC];
     // Compute sorted indices w.r.t. cell IDs in iCells
     std::vector<std::ptrdiff_t> p(iCells.size());
     std::iota(p.begin(), p.end(), 0);
     std::sort(p.begin(), p.end(), [&iCells](auto i, auto j) { return iCells[i] < iCells[j]; });
-    // Reduce indices to only include unique values of iCells
-    auto pu = std::unique(p.begin(), p.end(), [&iCells](auto i, auto j) { return iCells[i] == iCells[j]; });
-    p.erase(pu, p.end());
-    // Copy cell IDs at computed indices to new in and out lists
-    {
-      std::vector<CellID> buffer(p.size());
-      std::transform(p.begin(), p.end(), buffer.begin(), [&iCells](auto i) { return iCells[i]; });
-      iCells = buffer;
+    // Copy unique cell IDs to new in and out lists, merging the components requested for duplicates
+    std::vector<CellID> iBuffer;
+    std::vector<CellID> oBuffer;
+    std::vector<std::uint32_t> componentsBuffer;
+    for (auto i : p) {
+      if (!iBuffer.empty() && iBuffer.back() == iCells[i]) {
+        componentsBuffer.back() |= oComponents[i];
+      } else {
+        iBuffer.emplace_back(iCells[i]);
+        oBuffer.emplace_back(oCells[i]);
+        componentsBuffer.emplace_back(oComponents[i]);
+      }
     }
-    {
-      std::vector<CellID> buffer(p.size());
-      std::transform(p.begin(), p.end(), buffer.begin(), [&oCells](auto i) { return oCells[i]; });
-      oCells = buffer;
+    iCells = std::move(iBuffer);
+    oCells = std::move(oBuffer);
+    oComponents = std::move(componentsBuffer);
+
+    if (_componentField) {
+      sortByComponent(iCells, oComponents, _componentCount, _componentCellsInboundFrom[iC]);
+      sortByComponent(oCells, oComponents, _componentCount, _componentCellsRequestedFrom[iC]);
     }
   }
 }
@@ -199,6 +280,14 @@ void BlockCommunicationNeighborhood<T,D>::send(SuperCommunicationTagCoordinator<
       cells.data(), cells.size(),
       _loadBalancer.rank(iC), coordinator.get(_iC, iC, 1), _neighborhoodComm);
     _cellsRequests[iC]->start();
+
+    if (_componentField) {
+      auto& components = _componentsRequestedFrom[iC];
+      _componentsRequests[iC] = std::make_unique<MpiSendRequest>(
+        components.data(), components.size(),
+        _loadBalancer.rank(iC), coordinator.get(_iC, iC, 2), _neighborhoodComm);
+      _componentsRequests[iC]->start();
+    }
   }
 }
 
@@ -235,6 +324,18 @@ void BlockCommunicationNeighborhood<T,D>::receive(SuperCommunicationTagCoordinat
       _loadBalancer.rank(iC),
       coordinator.get(iC, _iC, 1),
       _neighborhoodComm);
+
+    if (_componentField) {
+      _componentsOutboundTo[iC].resize(newOutboundCount);
+      singleton::mpi().receive(
+        _componentsOutboundTo[iC].data(),
+        _componentsOutboundTo[iC].size(),
+        _loadBalancer.rank(iC),
+        coordinator.get(iC, _iC, 2),
+        _neighborhoodComm);
+      sortByComponent(_cellsOutboundTo[iC], _componentsOutboundTo[iC], _componentCount,
+                      _componentCellsOutboundTo[iC]);
+    }
   });
 }
 
@@ -244,6 +345,9 @@ void BlockCommunicationNeighborhood<T,D>::wait()
   forNeighbors([&](int iC) {
     _fieldRequests[iC]->wait();
     _cellsRequests[iC]->wait();
+    if (_componentField) {
+      _componentsRequests[iC]->wait();
+    }
   });
 }
 
@@ -277,6 +381,27 @@ BlockCommunicationNeighborhood<T,D>::getCellsRequestedFrom(int iC) const
   return _cellsRequestedFrom.at(iC);
 }
 
+template <typename T, unsigned D>
+const std::vector<std::vector<CellID>>&
+BlockCommunicationNeighborhood<T,D>::getComponentCellsOutboundTo(int iC) const
+{
+  return _componentCellsOutboundTo.at(iC);
+}
+
+template <typename T, unsigned D>
+const std::vector<std::vector<CellID>>&
+BlockCommunicationNeighborhood<T,D>::getComponentCellsInboundFrom(int iC) const
+{
+  return _componentCellsInboundFrom.at(iC);
+}
+
+template <typename T, unsigned D>
+const std::vector<std::vector<CellID>>&
+BlockCommunicationNeighborhood<T,D>::getComponentCellsRequestedFrom(int iC) const
+{
+  return _componentCellsRequestedFrom.at(iC);
+}
+
 // *INDENT-ON*
 
 }
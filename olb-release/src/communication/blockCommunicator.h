@@ -52,6 +52,23 @@ struct BlockCommunicator {
   virtual void send()    = 0;
   virtual void unpack()  = 0;
   virtual void wait()    = 0;
+
+  /// Unpack completed receives, returns true iff all of them were unpacked
+  /**
+   * Blocks until completion unless overridden
+   **/
+  virtual bool tryUnpack() {
+    unpack();
+    return true;
+  }
+  /// Returns true iff all sends were completed
+  /**
+   * Blocks until completion unless overridden
+   **/
+  virtual bool tryWait() {
+    wait();
+    return true;
+  }
 #else
   virtual void copy()    = 0;
 #endif
@@ -27,6 +27,7 @@
 #include <vector>
 #include <cstdint>
 #include <typeindex>
+#include <stdexcept>
 
 #include "core/blockStructure.h"
 
@@ -84,6 +85,31 @@ struct Communicatable {
    **/
   virtual std::size_t deserialize(ConstSpan<CellID> indices,
                                   const std::uint8_t* buffer) = 0;
+
+  /// Get serialized size for each component iD at locations `indices[iD]`
+  virtual std::size_t sizeOfComponents(const std::vector<std::vector<CellID>>& indices) const
+  {
+    throw std::logic_error("Communicatable does not support component-wise communication");
+  }
+  /// Serialize each component iD at locations `indices[iD]` to `buffer`
+  /**
+   * Used to communicate only a subset of e.g. the populations of each cell
+   * \returns size of serialized data in bytes
+   **/
+  virtual std::size_t serializeComponents(const std::vector<std::vector<CellID>>& indices,
+                                          std::uint8_t* buffer) const
+  {
+    throw std::logic_error("Communicatable does not support component-wise communication");
+  }
+  /// Deserialize each component iD at locations `indices[iD]` from `buffer`
+  /**
+   * \returns size of serialized data in bytes
+   **/
+  virtual std::size_t deserializeComponents(const std::vector<std::vector<CellID>>& indices,
+                                            const std::uint8_t* buffer)
+  {
+    throw std::logic_error("Communicatable does not support component-wise communication");
+  }
 };
 
 template <typename COMMUNICATEE>
@@ -258,18 +284,46 @@ private:
   COMMUNICATEE& _communicatee;
   const std::vector<std::type_index>& _fields;
 
+  /// Field to be communicated component-wise at _componentIndices, if any
+  std::type_index _componentField;
+  const std::vector<std::vector<CellID>>* _componentIndices;
+
+  bool isCommunicatedComponentWise(std::type_index field) const
+  {
+    return _componentIndices != nullptr && field == _componentField;
+  }
+
 public:
   MultiConcreteCommunicatable(COMMUNICATEE& communicatee,
                               const std::vector<std::type_index>& fields):
     _communicatee{communicatee},
-    _fields{fields} { }
+    _fields{fields},
+    _componentField{typeid(void)},
+    _componentIndices{nullptr} { }
+
+  /// Communicate componentField only at the locations given for each of its components
+  /**
+   * All other fields are communicated at the locations passed to (de)serialize
+   **/
+  MultiConcreteCommunicatable(COMMUNICATEE& communicatee,
+                              const std::vector<std::type_index>& fields,
+                              std::type_index componentField,
+                              const std::vector<std::vector<CellID>>& componentIndices):
+    _communicatee{communicatee},
+    _fields{fields},
+    _componentField{componentField},
+    _componentIndices{&componentIndices} { }
 
   /// Get serialized size for data at locations `indices`
   std::size_t size(ConstSpan<CellID> indices) const override
   {
     std::size_t size = 0;
     for (auto& field : _fields) {
-      size += _communicatee.getCommunicatable(field).size(indices);
+      if (isCommunicatedComponentWise(field)) {
+        size += _communicatee.getCommunicatable(field).sizeOfComponents(*_componentIndices);
+      } else {
+        size += _communicatee.getCommunicatable(field).size(indices);
+      }
     }
     return size;
   }
@@ -280,7 +334,11 @@ public:
   {
     std::uint8_t* curr = buffer;
     for (auto& field : _fields) {
-      curr += _communicatee.getCommunicatable(field).serialize(indices, curr);
+      if (isCommunicatedComponentWise(field)) {
+        curr += _communicatee.getCommunicatable(field).serializeComponents(*_componentIndices, curr);
+      } else {
+        curr += _communicatee.getCommunicatable(field).serialize(indices, curr);
+      }
     }
     return curr - buffer;
   }
@@ -291,14 +349,17 @@ public:
   {
     const std::uint8_t* curr = buffer;
     for (auto& field : _fields) {
-      curr += _communicatee.getCommunicatable(field).deserialize(indices, curr);
+      if (isCommunicatedComponentWise(field)) {
+        curr += _communicatee.getCommunicatable(field).deserializeComponents(*_componentIndices, curr);
+      } else {
+        curr += _communicatee.getCommunicatable(field).deserialize(indices, curr);
+      }
     }
     return curr - buffer;
   }
 };
 
 
-
 }
 
 #endif
@@ -0,0 +1,181 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef MPI_BUFFER_ARENA_H
+#define MPI_BUFFER_ARENA_H
+#ifdef PARALLEL_MODE_MPI
+
+#include "mpi.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <new>
+#include <vector>
+
+namespace olb {
+
+/// Pool of aligned communication buffers carved from few large allocations
+/**
+ * Chunks are allocated using MPI_Alloc_mem, i.e. they may be pre-registered
+ * with the interconnect by the MPI implementation. Chunks are never moved so
+ * buffers stay valid for the lifetime of the persistent requests bound to them.
+ * Released buffers are reused for later allocations of at most the same size,
+ * e.g. when communicators are reconstructed by SuperCommunicator::exchangeRequests.
+ *
+ * Shared by all communicators of a SuperLattice, i.e. the buffers of all stages
+ * are packed densely instead of being scattered over the heap.
+ **/
+class MpiBufferArena {
+public:
+  /// Alignment of all buffers (cache line)
+  static constexpr std::size_t alignment = 64;
+
+  /// Region of the arena, returned to the arena on destruction
+  class Buffer {
+  private:
+    MpiBufferArena* _arena;
+    std::uint8_t* _data;
+    std::size_t _size;
+
+  public:
+    Buffer(MpiBufferArena& arena, std::uint8_t* data, std::size_t size):
+      _arena(&arena),
+      _data(data),
+      _size(size) { }
+
+    ~Buffer() {
+      if (_arena) {
+        _arena->release(_data, _size);
+      }
+    }
+
+    Buffer(Buffer&& rhs):
+      _arena(rhs._arena),
+      _data(rhs._data),
+      _size(rhs._size) {
+      rhs._arena = nullptr;
+    }
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+    Buffer& operator=(Buffer&&) = delete;
+
+    std::uint8_t* get() const {
+      return _data;
+    }
+    /// Usable size in bytes (rounded up to alignment)
+    std::size_t size() const {
+      return _size;
+    }
+  };
+
+private:
+  struct Chunk {
+    void* memory;
+    std::uint8_t* begin;
+    std::size_t size;
+    std::size_t used;
+  };
+
+  /// Minimal size of newly allocated chunks
+  const std::size_t _chunkSize;
+  std::vector<Chunk> _chunks;
+  /// Released buffers by size
+  std::multimap<std::size_t,std::uint8_t*> _released;
+
+  static std::size_t alignUp(std::size_t size) {
+    return ((size + alignment - 1) / alignment) * alignment;
+  }
+
+  void release(std::uint8_t* data, std::size_t size) {
+    _released.emplace(size, data);
+  }
+
+  std::uint8_t* allocateInChunk(std::size_t size) {
+    for (auto& chunk : _chunks) {
+      if (chunk.size - chunk.used >= size) {
+        std::uint8_t* data = chunk.begin + chunk.used;
+        chunk.used += size;
+        return data;
+      }
+    }
+    Chunk chunk{};
+    chunk.size = std::max(_chunkSize, size);
+    if (MPI_Alloc_mem(chunk.size + alignment, MPI_INFO_NULL, &chunk.memory) != MPI_SUCCESS) {
+      throw std::bad_alloc();
+    }
+    const auto address = reinterpret_cast<std::uintptr_t>(chunk.memory);
+    chunk.begin = static_cast<std::uint8_t*>(chunk.memory) + (alignUp(address) - address);
+    chunk.used = size;
+    _chunks.emplace_back(chunk);
+    return chunk.begin;
+  }
+
+public:
+  MpiBufferArena(std::size_t chunkSize = std::size_t{1} << 22):
+    _chunkSize(alignUp(chunkSize)) { }
+
+  ~MpiBufferArena() {
+    int finalized{};
+    MPI_Finalized(&finalized);
+    if (!finalized) {
+      for (auto& chunk : _chunks) {
+        MPI_Free_mem(chunk.memory);
+      }
+    }
+  }
+
+  MpiBufferArena(const MpiBufferArena&) = delete;
+  MpiBufferArena& operator=(const MpiBufferArena&) = delete;
+
+  /// Returns zero-initialized buffer of at least size bytes
+  Buffer allocate(std::size_t size) {
+    size = alignUp(std::max(size, std::size_t{1}));
+    std::uint8_t* data{};
+    if (auto released = _released.lower_bound(size); released != _released.end()) {
+      size = released->first;
+      data = released->second;
+      _released.erase(released);
+    } else {
+      data = allocateInChunk(size);
+    }
+    std::fill(data, data + size, 0);
+    return Buffer(*this, data, size);
+  }
+
+  /// Returns total size of all chunks in bytes
+  std::size_t getAllocatedSize() const {
+    std::size_t size = 0;
+    for (const auto& chunk : _chunks) {
+      size += chunk.size;
+    }
+    return size;
+  }
+
+};
+
+}
+
+#endif
+#endif
@@ -35,7 +35,7 @@ namespace olb {
 
 MPI_Group_Wrapper::MPI_Group_Wrapper()
 {
-  if (MPI_Comm_dup(MPI_COMM_WORLD, &_commGroup) != MPI_SUCCESS) {
+  if (MPI_Comm_dup(singleton::mpi().getCommunicator(), &_commGroup) != MPI_SUCCESS) {
     throw std::runtime_error("Unable to duplicate MPI communicator");
   }
 }
@@ -21,6 +21,7 @@
 #include "mpiManager.h"
 
 #include <unistd.h>
+#include <stdexcept>
 
 namespace olb {
 
@@ -34,25 +35,91 @@ MpiManager& mpi()
 
 #ifdef PARALLEL_MODE_MPI
 
-MpiManager::MpiManager() : ok(false), clout(std::cout,"MpiManager")
+MPI_Comm MpiManager::activeComm = MPI_COMM_WORLD;
+
+MpiProgressThread::MpiProgressThread(std::chrono::microseconds interval):
+  _interval(interval),
+  _nActive(0),
+  _running(true)
+{
+  MPI_Comm_dup(MPI_COMM_SELF, &_comm);
+  _thread = std::thread(&MpiProgressThread::poll, this);
+}
+
+MpiProgressThread::~MpiProgressThread()
+{
+  {
+    const std::scoped_lock lock(_mutex);
+    _running = false;
+  }
+  _condition.notify_one();
+  _thread.join();
+  MPI_Comm_free(&_comm);
+}
+
+void MpiProgressThread::poll()
+{
+  while (true) {
+    {
+      std::unique_lock lock(_mutex);
+      _condition.wait(lock, [&]() {
+        return !_running || _nActive > 0;
+      });
+      if (!_running) {
+        return;
+      }
+    }
+    int flag{};
+    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, _comm, &flag, MPI_STATUS_IGNORE);
+    if (_interval.count() > 0) {
+      std::this_thread::sleep_for(_interval);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void MpiProgressThread::begin()
+{
+  {
+    const std::scoped_lock lock(_mutex);
+    _nActive += 1;
+  }
+  _condition.notify_one();
+}
+
+void MpiProgressThread::end()
+{
+  const std::scoped_lock lock(_mutex);
+  _nActive -= 1;
+}
+
+MpiManager::MpiManager() : ok(false), threadLevel(MPI_THREAD_SINGLE), clout(std::cout,"MpiManager")
 { }
 
 MpiManager::~MpiManager()
 {
+  progressThread.reset();
   if (ok) {
     MPI_Finalize();
     ok = false;
   }
 }
 
-void MpiManager::init(int *argc, char ***argv, bool verbose)
+void MpiManager::init(int *argc, char ***argv, bool verbose, int requiredThreadLevel)
 {
   int ok0{};
   MPI_Initialized(&ok0);
   if (ok0) {
     return;
   }
-  int ok1 = MPI_Init(argc, argv);
+  int ok1 = MPI_SUCCESS;
+  if (requiredThreadLevel == MPI_THREAD_SINGLE) {
+    ok1 = MPI_Init(argc, argv);
+    MPI_Query_thread(&threadLevel);
+  } else {
+    ok1 = MPI_Init_thread(argc, argv, requiredThreadLevel, &threadLevel);
+  }
   int ok2 = MPI_Comm_rank(MPI_COMM_WORLD, &taskId);
   int ok3 = MPI_Comm_size(MPI_COMM_WORLD, &numTasks);
   int ok4 = MPI_Comm_set_errhandler(MPI_COMM_WORLD, MPI_ERRORS_ARE_FATAL);
@@ -60,6 +127,67 @@ void MpiManager::init(int *argc, char ***argv, bool verbose)
   if (verbose) {
     clout << "Sucessfully initialized, numThreads=" << getSize() << std::endl;
   }
+  if (threadLevel < requiredThreadLevel) {
+    clout << "Warning: Requested MPI thread level is not available, provided level is "
+          << threadLevel << std::endl;
+  }
+}
+
+int MpiManager::getThreadLevel() const
+{
+  return threadLevel;
+}
+
+int MpiManager::getThreadLevel(const std::string& name)
+{
+  if (name == "single") {
+    return MPI_THREAD_SINGLE;
+  } else if (name == "funneled") {
+    return MPI_THREAD_FUNNELED;
+  } else if (name == "serialized") {
+    return MPI_THREAD_SERIALIZED;
+  } else if (name == "multiple") {
+    return MPI_THREAD_MULTIPLE;
+  } else {
+    throw std::invalid_argument("Invalid MPI thread level: " + name);
+  }
+}
+
+void MpiManager::startProgressThread(std::chrono::microseconds interval)
+{
+  if (!ok) {
+    return;
+  }
+  if (threadLevel < MPI_THREAD_MULTIPLE) {
+    throw std::runtime_error("MPI progress thread requires MPI_THREAD_MULTIPLE");
+  }
+  if (!progressThread) {
+    progressThread = std::make_unique<MpiProgressThread>(interval);
+  }
+}
+
+void MpiManager::stopProgressThread()
+{
+  progressThread.reset();
+}
+
+bool MpiManager::hasProgressThread() const
+{
+  return bool(progressThread);
+}
+
+void MpiManager::beginProgress()
+{
+  if (progressThread) {
+    progressThread->begin();
+  }
+}
+
+void MpiManager::endProgress()
+{
+  if (progressThread) {
+    progressThread->end();
+  }
 }
 
 int MpiManager::getSize() const
@@ -82,6 +210,21 @@ bool MpiManager::isMainProcessor() const
   return bossId() == getRank();
 }
 
+MPI_Comm MpiManager::getCommunicator()
+{
+  return activeComm;
+}
+
+void MpiManager::setCommunicator(MPI_Comm comm)
+{
+  activeComm = comm;
+  if (!ok) {
+    return;
+  }
+  MPI_Comm_rank(activeComm, &taskId);
+  MPI_Comm_size(activeComm, &numTasks);
+}
+
 double MpiManager::getTime() const
 {
   if (!ok) {
@@ -32,6 +32,10 @@
 
 #include <vector>
 #include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 #endif
 
 #include <string>
@@ -85,12 +89,77 @@ public:
   void swap(MpiNonBlockingHelper& rhs);
 };
 
+/// Thread asynchronously progressing non-blocking MPI communication
+/**
+ * Many MPI implementations only progress pending transfers during calls into
+ * the library. While at least one communication is in flight (see begin, end)
+ * this thread polls the progress engine via MPI_Iprobe on a private
+ * communicator. The requests themselves are never tested by this thread as
+ * concurrently completing the same request is erroneous.
+ *
+ * Requires MPI to be initialized with MPI_THREAD_MULTIPLE.
+ **/
+class MpiProgressThread {
+private:
+  /// Private communicator that is only probed
+  MPI_Comm _comm;
+  /// Time to sleep between polls (busy polling if zero)
+  const std::chrono::microseconds _interval;
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  /// Number of communications currently in flight
+  std::size_t _nActive;
+  bool _running;
+
+  std::thread _thread;
+
+  void poll();
+
+public:
+  MpiProgressThread(std::chrono::microseconds interval);
+  ~MpiProgressThread();
+
+  MpiProgressThread(const MpiProgressThread&) = delete;
+  MpiProgressThread& operator=(const MpiProgressThread&) = delete;
+
+  /// Start polling until matching call to end
+  void begin();
+  void end();
+};
+
 /// Wrapper functions that simplify the use of MPI
 
 class MpiManager {
 public:
   /// Initializes the mpi manager
-  void init(int *argc, char ***argv, bool verbose=true);
+  /**
+   * requiredThreadLevel is one of MPI_THREAD_{SINGLE,FUNNELED,SERIALIZED,MULTIPLE}.
+   * The actually provided thread level is available via getThreadLevel.
+   **/
+  void init(int *argc, char ***argv, bool verbose=true, int requiredThreadLevel=MPI_THREAD_SINGLE);
+  /// Returns MPI thread level provided by the implementation
+  int getThreadLevel() const;
+  /// Returns MPI thread level of name (single, funneled, serialized or multiple)
+  static int getThreadLevel(const std::string& name);
+
+  /// Start thread driving the progress of non-blocking communication
+  /**
+   * Requires MPI_THREAD_MULTIPLE. Local to the calling process.
+   **/
+  void startProgressThread(std::chrono::microseconds interval = std::chrono::microseconds(20));
+  /// Stop thread driving the progress of non-blocking communication
+  void stopProgressThread();
+  /// Returns true iff asynchronous progress thread is running
+  bool hasProgressThread() const;
+  /// Declare start of a non-blocking communication that should progress asynchronously
+  /**
+   * No-op if no progress thread is running. Must be matched by endProgress.
+   **/
+  void beginProgress();
+  /// Declare completion of a non-blocking communication
+  void endProgress();
+
   /// Returns the number of processes
   int getSize() const;
   /// Returns the process ID
@@ -101,171 +170,180 @@ public:
   bool isMainProcessor() const;
   /// Returns universal MPI-time in seconds
   double getTime() const;
+  /// Returns the communicator used by default for all operations
+  static MPI_Comm getCommunicator();
+  /// Restricts all subsequent operations (and getSize, getRank) to comm
+  /**
+   * Used e.g. to run independent simulations on disjoint groups of processes.
+   * Communicators duplicated by lattices and geometries are derived from the
+   * communicator active at their construction.
+   **/
+  void setCommunicator(MPI_Comm comm);
 
   /// Synchronizes the processes
-  void barrier(MPI_Comm comm = MPI_COMM_WORLD);
+  void barrier(MPI_Comm comm = getCommunicator());
 
   /// Synchronizes the processes and wait to ensure correct cout order
-  void synchronizeIO(unsigned tDelay = 100, MPI_Comm comm = MPI_COMM_WORLD);
+  void synchronizeIO(unsigned tDelay = 100, MPI_Comm comm = getCommunicator());
 
   /// Sends data at *buf, blocking
   template <typename T>
-  void send(T *buf, int count, int dest, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void send(T *buf, int count, int dest, int tag = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void send(util::ADf<T,DIM> *buf, int count, int dest, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void send(util::ADf<T,DIM> *buf, int count, int dest, int tag = 0, MPI_Comm comm = getCommunicator());
   template<typename... args>
-  void send(std::vector<args...>& vec, int dest, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD){
+  void send(std::vector<args...>& vec, int dest, int tag = 0, MPI_Comm comm = getCommunicator()){
     send( vec.data(), vec.size(), dest, tag, comm );
   }
   template<class T, std::size_t N>
-  void send(std::array<T,N>& array, int dest, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD){
+  void send(std::array<T,N>& array, int dest, int tag = 0, MPI_Comm comm = getCommunicator()){
     send( array.data(), array.size(), dest, tag, comm );
   }
 
   /// Initialize persistent non-blocking send
   template <typename T>
-  void sendInit(T *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void sendInit(T *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void sendInit(util::ADf<T,DIM> *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void sendInit(util::ADf<T,DIM> *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
 
   /// Sends data at *buf, non blocking
   template <typename T>
-  void iSend(T *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void iSend(T *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void iSend(util::ADf<T,DIM> *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void iSend(util::ADf<T,DIM> *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
 
   /// Sends data at *buf, non blocking and buffered
   template <typename T>
-  void ibSend(T *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void ibSend(T *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void ibSend(util::ADf<T,DIM> *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void ibSend(util::ADf<T,DIM> *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
 
   /// Probe size of incoming message
-  std::size_t probeReceiveSize(int source, MPI_Datatype type, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  std::size_t probeReceiveSize(int source, MPI_Datatype type, int tag = 0, MPI_Comm comm = getCommunicator());
   /// Probe size of incoming message with TYPE
   template <typename TYPE>
-  std::size_t probeReceiveSize(int source, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  std::size_t probeReceiveSize(int source, int tag = 0, MPI_Comm comm = getCommunicator());
 
   /// Receives data at *buf, blocking
   template <typename T>
-  void receive(T *buf, int count, int source, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void receive(T *buf, int count, int source, int tag = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void receive(util::ADf<T,DIM> *buf, int count, int source, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void receive(util::ADf<T,DIM> *buf, int count, int source, int tag = 0, MPI_Comm comm = getCommunicator());
   template<typename... args>
-  void receive(std::vector<args...>& vec, int source, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD){
+  void receive(std::vector<args...>& vec, int source, int tag = 0, MPI_Comm comm = getCommunicator()){
     receive( vec.data(), vec.size(), source, tag, comm );
   }
   template<class T, std::size_t N>
-  void receive(std::array<T,N>& array, int source, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD){
+  void receive(std::array<T,N>& array, int source, int tag = 0, MPI_Comm comm = getCommunicator()){
     receive( array.data(), array.size(), source, tag, comm );
   }
 
   /// Initialize persistent non-blocking receive
   template <typename T>
-  void recvInit(T *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void recvInit(T *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void recvInit(util::ADf<T,DIM> *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void recvInit(util::ADf<T,DIM> *buf, int count, int dest, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
 
   /// Receives data at *buf, non blocking
   template <typename T>
-  void iRecv(T *buf, int count, int source, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void iRecv(T *buf, int count, int source, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void iRecv(util::ADf<T,DIM> *buf, int count, int source, MPI_Request* request, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void iRecv(util::ADf<T,DIM> *buf, int count, int source, MPI_Request* request, int tag = 0, MPI_Comm comm = getCommunicator());
 
   /// Send and receive data between two partners
   template <typename T>
   void sendRecv(T *sendBuf, T *recvBuf, int count, int dest, int source, int tag = 0,
-                MPI_Comm comm = MPI_COMM_WORLD);
+                MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
   void sendRecv(util::ADf<T,DIM> *sendBuf, util::ADf<T,DIM> *recvBuf, int count,
-                int dest, int source, int tag = 0, MPI_Comm comm = MPI_COMM_WORLD);
+                int dest, int source, int tag = 0, MPI_Comm comm = getCommunicator());
 
   /// Sends data to master processor
   template <typename T>
-  void sendToMaster(T* sendBuf, int sendCount, bool iAmRoot, MPI_Comm comm = MPI_COMM_WORLD);
+  void sendToMaster(T* sendBuf, int sendCount, bool iAmRoot, MPI_Comm comm = getCommunicator());
 
   /// Scatter data from one processor over multiple processors
   template <typename T>
   void scatterv(T *sendBuf, int* sendCounts, int* displs,
-                T* recvBuf, int recvCount, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+                T* recvBuf, int recvCount, int root = 0, MPI_Comm comm = getCommunicator());
 
   /// Gather data from multiple processors to one processor
   template <typename T>
-  void gather(T* sendBuf, int sendCount, T* recvBuf, int recvCount, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void gather(T* sendBuf, int sendCount, T* recvBuf, int recvCount, int root = 0, MPI_Comm comm = getCommunicator());
 
   /// Gather data from multiple processors to every processor
   template <typename T>
-  void allGather(T* sendBuf, int sendCount, T* recvBuf, int recvCount, MPI_Comm comm = MPI_COMM_WORLD);
+  void allGather(T* sendBuf, int sendCount, T* recvBuf, int recvCount, MPI_Comm comm = getCommunicator());
 
   /// Gather data from multiple processors to one processor
   template <typename T>
-  void gatherv(T* sendBuf, int sendCount, T* recvBuf, int* recvCounts, int* displs, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void gatherv(T* sendBuf, int sendCount, T* recvBuf, int* recvCounts, int* displs, int root = 0, MPI_Comm comm = getCommunicator());
 
   /// Gather data from multiple processors to every processor
   template <typename T>
-  void allGatherv(T* sendBuf, int sendCount, T* recvBuf, int* recvCounts, int* displs, MPI_Comm comm = MPI_COMM_WORLD);
+  void allGatherv(T* sendBuf, int sendCount, T* recvBuf, int* recvCounts, int* displs, MPI_Comm comm = getCommunicator());
 
   /// Broadcast data from one processor to multiple processors
   template <typename T>
-  void bCast(T* sendBuf, int sendCount, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void bCast(T* sendBuf, int sendCount, int root = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void bCast(util::ADf<T,DIM>* sendBuf, int sendCount, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void bCast(util::ADf<T,DIM>* sendBuf, int sendCount, int root = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void bCast(BlockData<2,util::ADf<T,DIM>,util::ADf<T,DIM>>& sendData, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void bCast(BlockData<2,util::ADf<T,DIM>,util::ADf<T,DIM>>& sendData, int root = 0, MPI_Comm comm = getCommunicator());
   template <typename T>
-  void bCast(T& sendVal, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void bCast(T& sendVal, int root = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void bCast(Vector<T,DIM>& sendData, int root = 0, MPI_Comm comm = MPI_COMM_WORLD) {
+  void bCast(Vector<T,DIM>& sendData, int root = 0, MPI_Comm comm = getCommunicator()) {
     bCast(sendData.data(), DIM, root, comm);
   }
 
   /// Broadcast data when root is unknown to other processors
   template <typename T>
-  void bCastThroughMaster(T* sendBuf, int sendCount, bool iAmRoot, MPI_Comm comm = MPI_COMM_WORLD);
+  void bCastThroughMaster(T* sendBuf, int sendCount, bool iAmRoot, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void bCastThroughMaster(util::ADf<T,DIM>* sendBuf, int sendCount, bool iAmRoot, MPI_Comm comm = MPI_COMM_WORLD);
+  void bCastThroughMaster(util::ADf<T,DIM>* sendBuf, int sendCount, bool iAmRoot, MPI_Comm comm = getCommunicator());
 
   /// Special case for broadcasting strings. Memory handling is automatic.
   void bCast(std::string& message, int root = 0);
   /// Special case for broadcasting BlockData2D
-  void bCast(BlockData<2,double,double>& sendData, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void bCast(BlockData<2,double,double>& sendData, int root = 0, MPI_Comm comm = getCommunicator());
   /// Special case for broadcasting BlockData2D
-  void bCast(BlockData<2,float,float>& sendData, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void bCast(BlockData<2,float,float>& sendData, int root = 0, MPI_Comm comm = getCommunicator());
 
   /// Reduction operation toward one processor
   template <typename T>
-  void reduce(T& sendVal, T& recvVal, MPI_Op op, int root = 0, MPI_Comm = MPI_COMM_WORLD);
+  void reduce(T& sendVal, T& recvVal, MPI_Op op, int root = 0, MPI_Comm = getCommunicator());
   template <typename T>
-  void reduce(T* sendVal, T* recvVal, int count, MPI_Op op, int root = 0, MPI_Comm = MPI_COMM_WORLD);
+  void reduce(T* sendVal, T* recvVal, int count, MPI_Op op, int root = 0, MPI_Comm = getCommunicator());
   template <typename T,unsigned DIM>
   void reduce(util::ADf<T,DIM>& sendVal, util::ADf<T,DIM>& recvVal,
-              MPI_Op op, int root = 0, MPI_Comm = MPI_COMM_WORLD);
+              MPI_Op op, int root = 0, MPI_Comm = getCommunicator());
   template <typename T,unsigned DIM>
   void reduce(BlockData<2,util::ADf<T,DIM>,util::ADf<T,DIM>>& sendVal,
               BlockData<2,util::ADf<T,DIM>,util::ADf<T,DIM>>& recvVal,
-              MPI_Op op, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+              MPI_Op op, int root = 0, MPI_Comm comm = getCommunicator());
 
   /// Element-per-element reduction of a vector of data
   template <typename T>
   void reduceVect(std::vector<T>& sendVal, std::vector<T>& recvVal,
-                  MPI_Op op, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+                  MPI_Op op, int root = 0, MPI_Comm comm = getCommunicator());
 
   /// Reduction operation, followed by a broadcast
   template <typename T>
-  void reduceAndBcast(T& reductVal, MPI_Op op, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void reduceAndBcast(T& reductVal, MPI_Op op, int root = 0, MPI_Comm comm = getCommunicator());
   template <typename T,unsigned DIM>
-  void reduceAndBcast(util::ADf<T,DIM>& reductVal, MPI_Op op, int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
+  void reduceAndBcast(util::ADf<T,DIM>& reductVal, MPI_Op op, int root = 0, MPI_Comm comm = getCommunicator());
 
   template <typename T>
-  void allreduce(const T* in, T* out, int count, MPI_Op op, MPI_Comm comm = MPI_COMM_WORLD);
+  void allreduce(const T* in, T* out, int count, MPI_Op op, MPI_Comm comm = getCommunicator());
 
   /// All reduction operation of a vector data
   template <typename T>
-  void allReduce(T& reductVal, MPI_Op op, MPI_Comm comm = MPI_COMM_WORLD);
+  void allReduce(T& reductVal, MPI_Op op, MPI_Comm comm = getCommunicator());
 
   /// Element-per-element all-reduction of a vector of data (in-place)
   template <typename T>
-  void allReduceVect(std::vector<T>& reductVal, MPI_Op op, MPI_Comm comm = MPI_COMM_WORLD);
+  void allReduceVect(std::vector<T>& reductVal, MPI_Op op, MPI_Comm comm = getCommunicator());
 
   /// Complete a non-blocking MPI operation
   void wait(MPI_Request* request, MPI_Status* status);
@@ -279,6 +357,9 @@ private:
 private:
   int numTasks, taskId;
   bool ok;
+  int threadLevel;
+  std::unique_ptr<MpiProgressThread> progressThread;
+  static MPI_Comm activeComm;
   mutable OstreamManager clout;
 
   friend MpiManager& mpi();
@@ -35,9 +35,27 @@ protected:
 
 public:
   MpiRequest():
-    _request{},
+    _request(MPI_REQUEST_NULL),
     _status{} { };
 
+  /// Frees the (inactive) persistent request unless MPI was already finalized
+  ~MpiRequest() {
+    int finalized{};
+    MPI_Finalized(&finalized);
+    if (!finalized && _request != MPI_REQUEST_NULL) {
+      MPI_Request_free(&_request);
+    }
+  }
+
+  MpiRequest(MpiRequest&& rhs):
+    _request(rhs._request),
+    _status(rhs._status) {
+    rhs._request = MPI_REQUEST_NULL;
+  }
+
+  MpiRequest(const MpiRequest&) = delete;
+  MpiRequest& operator=(const MpiRequest&) = delete;
+
   inline void start() {
     MPI_Start(&_request);
   }
@@ -67,10 +85,6 @@ public:
       tag,
       communicator);
   }
-
-  ~MpiSendRequest() {
-    //MPI_Request_free(&this->_request);
-  }
 };
 
 /// Non-blocking MPI receive request
@@ -87,10 +101,6 @@ public:
       tag,
       communicator);
   }
-
-  ~MpiRecvRequest() {
-    //MPI_Request_free(&this->_request);
-  }
 };
 
 }
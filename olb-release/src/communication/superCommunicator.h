@@ -74,6 +74,8 @@ private:
   bool _enabled = false;
   /// True iff requests are synced between processes
   bool _ready   = false;
+  /// Unique ID of the most recent exchange of requests
+  std::size_t _revision = 0;
 
 public:
   SuperCommunicator(SUPER& super);
@@ -107,14 +109,83 @@ public:
   /// Request all indicated cells in overlap of width for communication
   void requestOverlap(int width, FunctorPtr<SuperIndicatorF<T,SUPER::d>>&& indicatorF);
 
+  /// Request only the components of FIELD propagating from the overlap into the core
+  /**
+   * Component iD of an overlap cell x is communicated iff x + velocities[iD]
+   * is a core cell. Used to restrict the exchange of populations prior to
+   * propagation to those actually streaming into a neighboring block.
+   *
+   * Cells requested by other means still communicate all components.
+   * Requires all participating blocks to use a CPU platform.
+   **/
+  template <typename FIELD>
+  void requestPropagation(const std::vector<LatticeR<SUPER::d>>& velocities) {
+    requestField<FIELD>();
+    auto& load = _super.getLoadBalancer();
+    for (int iC = 0; iC < load.size(); ++iC) {
+      _blockNeighborhoods[iC]->requestPropagation(typeid(FIELD), velocities);
+    }
+    _ready = false;
+    _enabled = true;
+  }
+
   /// Remove all requested cells
   void clearRequestedCells();
 
   /// Exchange requests between processes
   void exchangeRequests();
+  /// Returns ID of the exchanged requests that differs after every exchangeRequests
+  /**
+   * Used to invalidate structures depending on the communication neighborhood.
+   **/
+  std::size_t getRevision() const {
+    return _revision;
+  }
 
   /// Perform communication
   void communicate();
+  /// Post receives and sends of communication
+  /**
+   * Together with finishCommunication this enables overlapping the
+   * communication of multiple independent super structures.
+   **/
+  void startCommunication();
+  /// Unpack received data and complete the communication
+  void finishCommunication();
+
+#ifdef PARALLEL_MODE_MPI
+  /// Post receives into the overlap of local block iC only
+  void receive(int iC);
+  /// Post sends of local block iC and copy the data of local neighbors into its overlap
+  /**
+   * Reads the cores of iC and of all blocks reported by forSourcesOf(iC).
+   **/
+  void send(int iC);
+  /// Unpack completed receives of local block iC, returns true iff all were unpacked
+  /**
+   * Non-blocking counterpart to finishCommunication for block iC.
+   **/
+  bool tryUnpack(int iC);
+  /// Returns true iff all sends of local block iC were completed
+  bool tryWait(int iC);
+#else
+  /// Perform communication into the overlap of local block iC only
+  /**
+   * Reads the cores of all blocks reported by forSourcesOf(iC).
+   **/
+  void communicate(int iC);
+#endif
+
+  /// Calls f(jC) for the local index jC of every block communicating into block iC
+  template <typename F>
+  void forSourcesOf(int iC, F f) const {
+    auto& load = _super.getLoadBalancer();
+    _blockNeighborhoods[iC]->forNeighbors([&](int globC) {
+      if (load.isLocal(globC)) {
+        f(load.loc(globC));
+      }
+    });
+  }
 
   /// Returns set of non-local neighborhood cuboid indices
   const std::set<int>& getRemoteCuboids() const;
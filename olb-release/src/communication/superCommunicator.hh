@@ -29,6 +29,7 @@
 #include "blockCommunicationNeighborhood.hh"
 
 #include <algorithm>
+#include <atomic>
 #include <stdexcept>
 
 namespace olb {
@@ -45,10 +46,10 @@ SuperCommunicator<T,SUPER>::SuperCommunicator(
 #endif
 {
 #ifdef PARALLEL_MODE_MPI
-  if (MPI_Comm_dup(MPI_COMM_WORLD, &_neighborhoodComm) != MPI_SUCCESS) {
+  if (MPI_Comm_dup(singleton::mpi().getCommunicator(), &_neighborhoodComm) != MPI_SUCCESS) {
     throw std::runtime_error("Unable to duplicate MPI communicator");
   }
-  if (MPI_Comm_dup(MPI_COMM_WORLD, &_communicatorComm) != MPI_SUCCESS) {
+  if (MPI_Comm_dup(singleton::mpi().getCommunicator(), &_communicatorComm) != MPI_SUCCESS) {
     throw std::runtime_error("Unable to duplicate MPI communicator");
   }
 #endif
@@ -142,6 +143,9 @@ void SuperCommunicator<T,SUPER>::exchangeRequests()
   }
 #endif
 
+  static std::atomic<std::size_t> nextRevision{1};
+  _revision = nextRevision++;
+
   _ready = true;
 }
 
@@ -188,6 +192,13 @@ void SuperCommunicator<T,SUPER>::clearRequestedCells()
 
 template <typename T, typename SUPER>
 void SuperCommunicator<T,SUPER>::communicate()
+{
+  startCommunication();
+  finishCommunication();
+}
+
+template <typename T, typename SUPER>
+void SuperCommunicator<T,SUPER>::startCommunication()
 {
   if (!_enabled) {
     return;
@@ -204,19 +215,93 @@ void SuperCommunicator<T,SUPER>::communicate()
   for (int iC = 0; iC < load.size(); ++iC) {
     _blockCommunicators[iC]->send();
   }
+  singleton::mpi().beginProgress();
+#else // not using PARALLEL_MODE_MPI
+  for (int iC = 0; iC < load.size(); ++iC) {
+    _blockCommunicators[iC]->copy();
+  }
+#endif
+}
+
+template <typename T, typename SUPER>
+void SuperCommunicator<T,SUPER>::finishCommunication()
+{
+  if (!_enabled) {
+    return;
+  }
+
+#ifdef PARALLEL_MODE_MPI
+  auto& load = _super.getLoadBalancer();
   for (int iC = 0; iC < load.size(); ++iC) {
     _blockCommunicators[iC]->unpack();
   }
   for (int iC = 0; iC < load.size(); ++iC) {
     _blockCommunicators[iC]->wait();
   }
+  singleton::mpi().endProgress();
+#endif
+}
+
+#ifdef PARALLEL_MODE_MPI
+
+template <typename T, typename SUPER>
+void SuperCommunicator<T,SUPER>::receive(int iC)
+{
+  if (!_enabled) {
+    return;
+  }
+  if (!_ready) {
+    throw std::logic_error("Requests must be re-exchanged after any changes");
+  }
+  _blockCommunicators[iC]->receive();
+}
+
+template <typename T, typename SUPER>
+void SuperCommunicator<T,SUPER>::send(int iC)
+{
+  if (!_enabled) {
+    return;
+  }
+  if (!_ready) {
+    throw std::logic_error("Requests must be re-exchanged after any changes");
+  }
+  _blockCommunicators[iC]->send();
+}
+
+template <typename T, typename SUPER>
+bool SuperCommunicator<T,SUPER>::tryUnpack(int iC)
+{
+  if (!_enabled) {
+    return true;
+  }
+  return _blockCommunicators[iC]->tryUnpack();
+}
+
+template <typename T, typename SUPER>
+bool SuperCommunicator<T,SUPER>::tryWait(int iC)
+{
+  if (!_enabled) {
+    return true;
+  }
+  return _blockCommunicators[iC]->tryWait();
+}
+
 #else // not using PARALLEL_MODE_MPI
-  for (int iC = 0; iC < load.size(); ++iC) {
-    _blockCommunicators[iC]->copy();
+
+template <typename T, typename SUPER>
+void SuperCommunicator<T,SUPER>::communicate(int iC)
+{
+  if (!_enabled) {
+    return;
   }
-#endif
+  if (!_ready) {
+    throw std::logic_error("Requests must be re-exchanged after any changes");
+  }
+  _blockCommunicators[iC]->copy();
 }
 
+#endif
+
 template <typename T, typename SUPER>
 const std::set<int>& SuperCommunicator<T,SUPER>::getRemoteCuboids() const
 {
@@ -278,6 +278,13 @@ private:
   /// Pointer to collision operator with highest cell fraction
   BlockCollisionO<T,DESCRIPTOR,PLATFORM>* _dominantCollisionO;
 
+  /// Compacted list of core cells not assigned to trivial dynamics
+  std::vector<CellID> _activeCells;
+  /// Pointer to non-trivial collision operator with highest cell fraction
+  BlockCollisionO<T,DESCRIPTOR,PLATFORM>* _dominantActiveCollisionO;
+  /// True iff _activeCells and _dominantActiveCollisionO need to be updated
+  bool _activeCellsModified;
+
   /// Returns (Dynamics, CollisionO, Mask) tuple for promise
   BlockCollisionO<T,DESCRIPTOR,PLATFORM>& resolve(DynamicsPromise<T,DESCRIPTOR>&& promise)
   {
@@ -301,6 +308,47 @@ private:
     }
   }
 
+  /// Returns true iff dynamics don't modify cells during collision
+  static bool isTrivial(std::type_index id)
+  {
+    return id == typeid(NoDynamics<T,DESCRIPTOR>)
+        || id == typeid(NoDynamicsWithZero<T,DESCRIPTOR>)
+        || id == typeid(NoDynamicsWithFixedDensity<T,DESCRIPTOR>);
+  }
+
+  /// Applies the dominant non-trivial dynamics to all non-trivial cells
+  /**
+   * Cells of trivial dynamics (e.g. solid cells of porous media) are not visited.
+   * Falls back to the dominant strategy if fused collision operators are present
+   * as these need to be applied to all cells.
+   **/
+  void collideNonTrivial()
+  {
+    if (_lattice.hasFusedCollisionO()) {
+      return collide(CollisionDispatchStrategy::Dominant);
+    }
+    if (_activeCellsModified) {
+      _dominantActiveCollisionO = nullptr;
+      for (auto& [id, value] : _map) {
+        auto& [promise, collisionO] = value;
+        if (!isTrivial(id) && (!_dominantActiveCollisionO || collisionO->weight() > _dominantActiveCollisionO->weight())) {
+          _dominantActiveCollisionO = collisionO.get();
+        }
+      }
+      _activeCells.clear();
+      for (CellID iCell=0; iCell < _lattice.getNcells(); ++iCell) {
+        if (_coreMask[iCell] && _operatorOfCells[iCell] && !isTrivial(_operatorOfCells[iCell]->id())) {
+          _activeCells.emplace_back(iCell);
+        }
+      }
+      _activeCells.shrink_to_fit();
+      _activeCellsModified = false;
+    }
+    if (_dominantActiveCollisionO) {
+      _dominantActiveCollisionO->applyNonTrivial(_lattice, _activeCells);
+    }
+  }
+
 public:
   /// Constructor for a BlockDynamicsMap
   BlockDynamicsMap(ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& lattice):
@@ -308,7 +356,9 @@ public:
     _dynamicsOfCells(new Dynamics<T,DESCRIPTOR>*                [_lattice.getNcells()] { nullptr }),
     _operatorOfCells(new BlockCollisionO<T,DESCRIPTOR,PLATFORM>*[_lattice.getNcells()] { nullptr }),
     _coreMask(lattice.template getData<CollisionSubdomainMask>()),
-    _dominantCollisionO(nullptr)
+    _dominantCollisionO(nullptr),
+    _dominantActiveCollisionO(nullptr),
+    _activeCellsModified(true)
   {
     _lattice.forCoreSpatialLocations([&](LatticeR<DESCRIPTOR::d> lattice) {
       _coreMask.set(_lattice.getCellId(lattice), true);
@@ -347,6 +397,7 @@ public:
       _dynamicsOfCells[iCell] = dynamics;
     }
     _dominantCollisionO = nullptr;
+    _activeCellsModified = true;
   }
 
   /// Executes local collision step for entire non-overlap area of lattice
@@ -357,6 +408,9 @@ public:
    *
    * Correspondingly, the alternative CollisionDispatchStrategy::Individual applies
    * all dynamics separately using a list-based approach.
+   *
+   * CollisionDispatchStrategy::SkipTrivial skips cells of trivial dynamics entirely. It is
+   * also used by Platform::CPU_SISD if trivial dynamics dominate (e.g. for low porosity).
    **/
   void collide(CollisionDispatchStrategy strategy)
   {
@@ -371,9 +425,19 @@ public:
                  < std::get<1>(rhs.second)->weight();
           })->second).get();
       }
+      if constexpr (PLATFORM == Platform::CPU_SISD) {
+        if (isTrivial(_dominantCollisionO->id()) && !_lattice.hasFusedCollisionO()) {
+          collideNonTrivial();
+          break;
+        }
+      }
       _dominantCollisionO->apply(_lattice, _coreMask, strategy);
       break;
 
+    case CollisionDispatchStrategy::SkipTrivial:
+      collideNonTrivial();
+      break;
+
     case CollisionDispatchStrategy::Individual:
       for (auto& [id, value] : _map) {
         auto& [promise, collisionO] = value;
@@ -389,6 +453,19 @@ public:
     }
   }
 
+  /// Executes collision of only the cells assigned to promised dynamics
+  /**
+   * Uses CollisionDispatchStrategy::Individual, intended for introspection
+   **/
+  void collide(const DynamicsPromise<T,DESCRIPTOR>& promise)
+  {
+    auto iter = _map.find(promise.id());
+    if (iter != _map.end()) {
+      auto& [_, collisionO] = std::get<1>(*iter);
+      collisionO->apply(_lattice, _coreMask, CollisionDispatchStrategy::Individual);
+    }
+  }
+
   /// Returns number of cells assigned to promised dynamics
   /**
    * Doesn't allocate, intended for introspection
@@ -469,6 +469,12 @@ private:
   BlockDynamicsMap<T,DESCRIPTOR,PLATFORM> _dynamicsMap;
   /// Optional custom callable replacing default collision application
   std::optional<std::function<void(ConcreteBlockLattice&)>> _customCollisionO;
+  /// Cell-wise operators fused into the collision step (CPU only)
+  std::vector<AbstractFusedCellO*> _fusedCollisionO;
+  /// Strategy used by collide to dispatch the dynamics of BlockDynamicsMap
+  CollisionDispatchStrategy _collisionDispatchStrategy;
+  /// OpenMP schedule of the collision loop (CPU only)
+  CollisionLoopSchedule _collisionLoopSchedule;
   /// Map of post processor stages
   std::map<std::type_index,
            std::map<int,
@@ -542,6 +548,56 @@ public:
     _customCollisionO = op;
   }
 
+  /// Apply op to each cell immediately prior to its collision
+  /**
+   * Only supported by CPU platforms. Ownership of op remains with the caller
+   * who is responsible for removing it using removeFusedCollisionO.
+   **/
+  void addFusedCollisionO(AbstractFusedCellO* op) {
+    if constexpr (!isPlatformCPU(PLATFORM)) {
+      throw std::logic_error("Fused collision operators are only supported on CPU platforms");
+    }
+    _fusedCollisionO.emplace_back(op);
+  }
+  void removeFusedCollisionO(AbstractFusedCellO* op) {
+    std::erase(_fusedCollisionO, op);
+  }
+  bool hasFusedCollisionO() const {
+    return !_fusedCollisionO.empty();
+  }
+  /// Apply fused operators to iCell, to be called by the collision operator
+  void applyFusedCollisionO(CellID iCell) {
+    for (AbstractFusedCellO* op : _fusedCollisionO) {
+      op->apply(iCell);
+    }
+  }
+
+  /// Set strategy used to dispatch collisions (default: Dominant on CPU, Individual otherwise)
+  void setCollisionDispatchStrategy(CollisionDispatchStrategy strategy) {
+    if constexpr (PLATFORM == Platform::CPU_SIMD) {
+      if (strategy != CollisionDispatchStrategy::Dominant) {
+        throw std::invalid_argument("Platform::CPU_SIMD only supports CollisionDispatchStrategy::Dominant");
+      }
+    }
+    if constexpr (PLATFORM != Platform::CPU_SISD) {
+      if (strategy == CollisionDispatchStrategy::SkipTrivial) {
+        throw std::invalid_argument("CollisionDispatchStrategy::SkipTrivial is only supported by Platform::CPU_SISD");
+      }
+    }
+    _collisionDispatchStrategy = strategy;
+  }
+  CollisionDispatchStrategy getCollisionDispatchStrategy() const {
+    return _collisionDispatchStrategy;
+  }
+
+  /// Set OpenMP schedule of the dominant collision loop (default: Dynamic)
+  void setCollisionLoopSchedule(CollisionLoopSchedule schedule) {
+    _collisionLoopSchedule = schedule;
+  }
+  CollisionLoopSchedule getCollisionLoopSchedule() const {
+    return _collisionLoopSchedule;
+  }
+
   BlockDynamicsMap<T,DESCRIPTOR,PLATFORM>& getDynamicsMap() {
     return _dynamicsMap;
   }
@@ -749,6 +805,9 @@ public:
   void send() override;
   void unpack() override;
   void wait() override;
+
+  bool tryUnpack() override;
+  bool tryWait() override;
 #else
   void copy() override;
 #endif
@@ -29,6 +29,8 @@
 #include "blockLattice.h"
 
 #include "introspection.h"
+#include "communication/ompManager.h"
+#include "communication/mpiBufferArena.h"
 
 #include <iterator>
 
@@ -306,11 +308,20 @@ void ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>::collide()
   if (_customCollisionO) {
     _customCollisionO->operator()(*this);
   } else {
+#ifdef PARALLEL_MODE_OMP
     if constexpr (isPlatformCPU(PLATFORM)) {
-      _dynamicsMap.collide(CollisionDispatchStrategy::Dominant);
-    } else {
-      _dynamicsMap.collide(CollisionDispatchStrategy::Individual);
+      // Picked up by the schedule(runtime) collision loops of this thread
+      switch (_collisionLoopSchedule) {
+      case CollisionLoopSchedule::Dynamic:
+        omp_set_schedule(omp_sched_dynamic, 1);
+        break;
+      case CollisionLoopSchedule::Static:
+        omp_set_schedule(omp_sched_static, 0);
+        break;
+      }
     }
+#endif
+    _dynamicsMap.collide(_collisionDispatchStrategy);
   }
 }
 
@@ -396,7 +407,10 @@ ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>::ConcreteBlockLattice(Vector<int,DES
   : BlockLattice<T,DESCRIPTOR>(size, padding, PLATFORM),
     _data(),
     _descriptorFields(),
-    _dynamicsMap(*this)
+    _dynamicsMap(*this),
+    _collisionDispatchStrategy{isPlatformCPU(PLATFORM) ? CollisionDispatchStrategy::Dominant
+                                                       : CollisionDispatchStrategy::Individual},
+    _collisionLoopSchedule{CollisionLoopSchedule::Dynamic}
 {
   DESCRIPTOR::fields_t::for_each([&](auto id) {
     using field = typename decltype(id)::type;
@@ -649,17 +663,21 @@ private:
 
   MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>> _source;
 
-  std::unique_ptr<std::uint8_t[]> _buffer;
+  MpiBufferArena::Buffer _buffer;
   MpiSendRequest _request;
 
 public:
   SendTask(MPI_Comm comm, int tag, int rank,
+           MpiBufferArena& arena,
            const std::vector<std::type_index>& fields,
            const std::vector<CellID>& cells,
-           ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block):
+           ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block,
+           const std::optional<std::type_index>& componentField = std::nullopt,
+           const std::vector<std::vector<CellID>>* componentCells = nullptr):
     _cells(cells),
-    _source(block, fields),
-    _buffer(new std::uint8_t[_source.size(_cells)] { }),
+    _source(componentField ? MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(block, fields, *componentField, *componentCells)
+                           : MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(block, fields)),
+    _buffer(arena.allocate(_source.size(_cells))),
     _request(_buffer.get(), _source.size(_cells),
              rank, tag, comm)
   { }
@@ -674,6 +692,11 @@ public:
   {
     _request.wait();
   }
+
+  bool isDone()
+  {
+    return _request.isDone();
+  }
 };
 
 /// Wrapper for a non-blocking block propagation receive request
@@ -686,9 +709,12 @@ private:
 
   MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>> _target;
 
-  std::unique_ptr<std::uint8_t[]> _buffer;
+  MpiBufferArena::Buffer _buffer;
   MpiRecvRequest _request;
 
+  /// True iff the data of the current receive was unpacked by tryUnpack
+  bool _unpacked = false;
+
 public:
   /// Manual replacement for std::reference_wrapper<RecvTask>
   /**
@@ -716,14 +742,18 @@ public:
   };
 
   RecvTask(MPI_Comm comm, int tag, int rank,
+           MpiBufferArena& arena,
            const std::vector<std::type_index>& fields,
            const std::vector<CellID>& cells,
-           ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block):
+           ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block,
+           const std::optional<std::type_index>& componentField = std::nullopt,
+           const std::vector<std::vector<CellID>>* componentCells = nullptr):
     _tag(tag),
     _rank(rank),
     _cells(cells),
-    _target(block, fields),
-    _buffer(new std::uint8_t[_target.size(_cells)] { }),
+    _target(componentField ? MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(block, fields, *componentField, *componentCells)
+                           : MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(block, fields)),
+    _buffer(arena.allocate(_target.size(_cells))),
     _request(_buffer.get(), _target.size(_cells),
              _rank, _tag, comm)
   { }
@@ -736,6 +766,7 @@ public:
 
   void receive()
   {
+    _unpacked = false;
     _request.start();
   };
 
@@ -748,6 +779,16 @@ public:
   {
     _target.deserialize(_cells, _buffer.get());
   }
+
+  /// Unpack iff the receive is completed, returns true iff the data was unpacked
+  bool tryUnpack()
+  {
+    if (!_unpacked && isDone()) {
+      unpack();
+      _unpacked = true;
+    }
+    return _unpacked;
+  }
 };
 
 #endif // PARALLEL_MODE_MPI
@@ -778,11 +819,16 @@ public:
   HomogeneousCopyTask(
     const std::vector<std::type_index>& fields,
     const std::vector<CellID>& targetCells, ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& target,
-    const std::vector<CellID>& sourceCells, ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& source):
+    const std::vector<CellID>& sourceCells, ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& source,
+    const std::optional<std::type_index>& componentField = std::nullopt,
+    const std::vector<std::vector<CellID>>* targetComponentCells = nullptr,
+    const std::vector<std::vector<CellID>>* sourceComponentCells = nullptr):
     _targetCells(targetCells),
     _sourceCells(sourceCells),
-    _target(target, fields),
-    _source(source, fields),
+    _target(componentField ? MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(target, fields, *componentField, *targetComponentCells)
+                           : MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(target, fields)),
+    _source(componentField ? MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(source, fields, *componentField, *sourceComponentCells)
+                           : MultiConcreteCommunicatable<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(source, fields)),
     _buffer(new std::uint8_t[_source.size(_sourceCells)] { })
   {
     OLB_ASSERT(_sourceCells.size() == _targetCells.size(),
@@ -815,6 +861,9 @@ ConcreteBlockCommunicator<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>::Concrete
 , _mpiCommunicator(comm)
 #endif
 {
+  // Set iff only the components propagating into the core are communicated for some field
+  const auto& componentField = neighborhood.getComponentField();
+
 #ifdef PARALLEL_MODE_MPI
   neighborhood.forNeighbors([&](int remoteC) {
     if (loadBalancer.isLocal(remoteC)) {
@@ -835,7 +884,10 @@ ConcreteBlockCommunicator<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>::Concrete
             _copyTasks.emplace_back(new HomogeneousCopyTask(
               neighborhood.getFieldsCommonWith(remoteC),
               neighborhood.getCellsInboundFrom(remoteC),   super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(_iC),
-              neighborhood.getCellsRequestedFrom(remoteC), super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(loadBalancer.loc(remoteC))));
+              neighborhood.getCellsRequestedFrom(remoteC), super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(loadBalancer.loc(remoteC)),
+              componentField,
+              componentField ? &neighborhood.getComponentCellsInboundFrom(remoteC)   : nullptr,
+              componentField ? &neighborhood.getComponentCellsRequestedFrom(remoteC) : nullptr));
             break;
         }
       }
@@ -844,17 +896,23 @@ ConcreteBlockCommunicator<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>::Concrete
         _sendTasks.emplace_back(std::make_unique<SendTask>(
           _mpiCommunicator, tagCoordinator.get(loadBalancer.glob(_iC), remoteC),
           loadBalancer.rank(remoteC),
+          super.getCommunicationBufferArena(),
           neighborhood.getFieldsCommonWith(remoteC),
           neighborhood.getCellsOutboundTo(remoteC),
-          super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(_iC)));
+          super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(_iC),
+          componentField,
+          componentField ? &neighborhood.getComponentCellsOutboundTo(remoteC) : nullptr));
       }
       if (!neighborhood.getCellsInboundFrom(remoteC).empty()) {
         _recvTasks.emplace_back(std::make_unique<RecvTask>(
           _mpiCommunicator, tagCoordinator.get(remoteC, loadBalancer.glob(_iC)),
           loadBalancer.rank(remoteC),
+          super.getCommunicationBufferArena(),
           neighborhood.getFieldsCommonWith(remoteC),
           neighborhood.getCellsInboundFrom(remoteC),
-          super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(_iC)));
+          super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(_iC),
+          componentField,
+          componentField ? &neighborhood.getComponentCellsInboundFrom(remoteC) : nullptr));
       }
     }
   });
@@ -865,7 +923,10 @@ ConcreteBlockCommunicator<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>::Concrete
       _copyTasks.emplace_back(new HomogeneousCopyTask(
         neighborhood.getFieldsCommonWith(localC),
         neighborhood.getCellsInboundFrom(localC),   super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(_iC),
-        neighborhood.getCellsRequestedFrom(localC), super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(loadBalancer.loc(localC))));
+        neighborhood.getCellsRequestedFrom(localC), super.template getBlock<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>(loadBalancer.loc(localC)),
+        componentField,
+        componentField ? &neighborhood.getComponentCellsInboundFrom(localC)   : nullptr,
+        componentField ? &neighborhood.getComponentCellsRequestedFrom(localC) : nullptr));
     }
   });
 #endif
@@ -926,6 +987,29 @@ void ConcreteBlockCommunicator<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>::wai
   }
 }
 
+template <typename T, typename DESCRIPTOR, Platform PLATFORM>
+bool ConcreteBlockCommunicator<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>::tryUnpack()
+{
+  bool unpacked = true;
+  for (auto& task : _recvTasks) {
+    unpacked &= task->tryUnpack();
+  }
+  return unpacked;
+}
+
+template <typename T, typename DESCRIPTOR, Platform PLATFORM>
+bool ConcreteBlockCommunicator<ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>>::tryWait()
+{
+  for (auto& task : _copyTasks) {
+    task->wait();
+  }
+  bool done = true;
+  for (auto& task : _sendTasks) {
+    done &= task->isDone();
+  }
+  return done;
+}
+
 #else // not using PARALLEL_MODE_MPI
 
 template <typename T, typename DESCRIPTOR, Platform PLATFORM>
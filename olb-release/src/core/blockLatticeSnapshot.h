@@ -0,0 +1,87 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef BLOCK_LATTICE_SNAPSHOT_H
+#define BLOCK_LATTICE_SNAPSHOT_H
+
+#include "blockLattice.h"
+
+#include <chrono>
+#include <limits>
+
+namespace olb {
+
+/// Restores the state of a block lattice on destruction
+/**
+ * Enables benchmarking of operators on the actual block state without
+ * disturbing the simulation. Statistics are disabled during its lifetime.
+ *
+ * Only the (serializable) state of the block itself is restored, side
+ * effects of e.g. fused couplings on other lattices are not.
+ **/
+template <typename T, typename DESCRIPTOR, Platform PLATFORM>
+class BlockLatticeSnapshot {
+private:
+  ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& _block;
+
+  std::vector<std::uint8_t> _data;
+  const LatticeStatistics<T> _statistics;
+  const bool _statisticsEnabled;
+
+public:
+  BlockLatticeSnapshot(ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block):
+    _block(block),
+    _data(block.getSerializableSize()),
+    _statistics(block.getStatistics()),
+    _statisticsEnabled(block.statisticsEnabled())
+  {
+    _block.save(_data.data());
+    _block.setStatisticsEnabled(false);
+  }
+
+  ~BlockLatticeSnapshot()
+  {
+    _block.load(_data.data());
+    _block.getStatistics() = _statistics;
+    _block.setStatisticsEnabled(_statisticsEnabled);
+  }
+};
+
+/// Returns the minimal runtime of f in seconds over repetitions following a warm-up call
+template <typename F>
+double measureMinimalRuntime(F f, unsigned repetitions)
+{
+  f();
+  double minTime = std::numeric_limits<double>::max();
+  for (unsigned i=0; i < repetitions; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    minTime = std::min(minTime, std::chrono::duration<double>(end - start).count());
+  }
+  return minTime;
+}
+
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include <memory>
 #include <array>
 #include <vector>
+#include <utility>
 
 #include "serializer.h"
 #include "meta.h"
@@ -244,7 +245,8 @@ public:
 
   const typename COLUMN::value_t* getComponentPointer(unsigned iDim) const
   {
-    return &_data[iDim][_index];
+    // Read via const columns, mutable access may allocate (e.g. SparseColumn)
+    return &std::as_const(_data)[iDim][_index];
   }
 
   typename COLUMN::value_t* getComponentPointer(unsigned iDim)
@@ -328,6 +330,38 @@ public:
     return D * size;
   }
 
+  /// Get serialized size for each component iD at locations `indices[iD]`
+  std::size_t sizeOfComponents(const std::vector<std::vector<CellID>>& indices) const override
+  {
+    std::size_t size = 0;
+    for (unsigned iD=0; iD < D; ++iD) {
+      size += ConcreteCommunicatable<COLUMN>(_vector[iD]).size(indices[iD]);
+    }
+    return size;
+  }
+
+  /// Serialize each component iD at locations `indices[iD]` to `buffer`
+  std::size_t serializeComponents(const std::vector<std::vector<CellID>>& indices,
+                                  std::uint8_t* buffer) const override
+  {
+    std::uint8_t* curr = buffer;
+    for (unsigned iD=0; iD < D; ++iD) {
+      curr += ConcreteCommunicatable<COLUMN>(_vector[iD]).serialize(indices[iD], curr);
+    }
+    return curr - buffer;
+  }
+
+  /// Deserialize each component iD at locations `indices[iD]` from `buffer`
+  std::size_t deserializeComponents(const std::vector<std::vector<CellID>>& indices,
+                                    const std::uint8_t* buffer) override
+  {
+    const std::uint8_t* curr = buffer;
+    for (unsigned iD=0; iD < D; ++iD) {
+      curr += ConcreteCommunicatable<COLUMN>(_vector[iD]).deserialize(indices[iD], curr);
+    }
+    return curr - buffer;
+  }
+
 };
 
 
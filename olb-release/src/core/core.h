@@ -27,6 +27,7 @@
 #include "expr.h"
 
 #include "threadPool.h"
+#include "taskGraph.h"
 
 #include "concepts.h"
 #include "fields.h"
@@ -46,7 +47,10 @@
 #include "superLattice.h"
 #include "superD.h"
 
+#include "superLatticeEnsemble.h"
 #include "superLatticeCoupling.h"
+#include "superLatticeAutotuner.h"
+#include "superLatticeRoofline.h"
 #include "superLatticePointCoupling.h"
 #include "superLatticeFieldReductionO.h"
 #include "superLatticePointExtraction.h"
@@ -29,6 +29,7 @@
 #include "data.hh"
 
 #include "superLattice.hh"
+#include "superLatticeEnsemble.hh"
 #include "blockLattice.hh"
 #include "blockD.hh"
 
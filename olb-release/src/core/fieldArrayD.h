@@ -195,7 +195,8 @@ public:
 
   const typename FIELD::template value_type<T>* getComponentPointer(unsigned iDim) const
   {
-    return &_data[iDim][_index];
+    // Read via const columns, mutable access may allocate (e.g. SparseColumn)
+    return &std::as_const(_data)[iDim][_index];
   }
 
   typename FIELD::template value_type<T>* getComponentPointer(unsigned iDim)
@@ -248,6 +249,9 @@ public:
   using column_type = typename ImplementationOf<typename FIELD::template column_type<T>,PLATFORM>::type;
 
   constexpr static Platform platform = PLATFORM;
+  /// True iff FIELD is stored only for explicitly set rows
+  constexpr static bool is_sparse = std::is_same_v<typename FIELD::template column_type<T>,
+                                                   AbstractSparseColumn<value_type>>;
 
   using ColumnVector<column_type,DESCRIPTOR::template size<FIELD>()>::operator[];
 
@@ -256,8 +260,17 @@ public:
                  DESCRIPTOR::template size<FIELD>()>(count)
   {
     const auto initial = FIELD::template getInitialValue<T,DESCRIPTOR>();
-    for (std::size_t i=0; i < count; ++i) {
-      this->getRowPointer(i) = initial;
+    if constexpr (is_sparse) {
+      for (unsigned iDim=0; iDim < DESCRIPTOR::template size<FIELD>(); ++iDim) {
+        this->operator[](iDim).setDefault(initial[iDim]);
+        if (iDim > 0) {
+          this->operator[](iDim).shareIndex(this->operator[](0));
+        }
+      }
+    } else {
+      for (std::size_t i=0; i < count; ++i) {
+        this->getRowPointer(i) = initial;
+      }
     }
   }
 
@@ -289,7 +302,7 @@ public:
       operator[](iDim).resize(newCount);
     }
     this->_count = newCount;
-    if (oldCount < newCount) {
+    if (oldCount < newCount && !is_sparse) {
       const auto initial = FIELD::template getInitialValue<T,DESCRIPTOR>();
       for (std::size_t i=oldCount; i < newCount; ++i) {
         this->getRowPointer(i) = initial;
@@ -51,7 +51,23 @@ void initialize(int *argc, char ***argv, bool multiOutput, bool verbose)
   // create an OstreamManager object in order to enable multi output
   olb::OstreamManager clout(std::cout, "olbInit");
   clout.setMultiOutput(multiOutput);
+#ifdef PARALLEL_MODE_MPI
+  int mpiThreadLevel = MPI_THREAD_SINGLE;
+  if (const char* envMpiThreadLevel = std::getenv("OLB_MPI_THREAD_LEVEL")) {
+    mpiThreadLevel = singleton::MpiManager::getThreadLevel(envMpiThreadLevel);
+  }
+  const char* envMpiProgressThread = std::getenv("OLB_MPI_PROGRESS_THREAD");
+  const bool mpiProgressThread = envMpiProgressThread && std::stoi(envMpiProgressThread) > 0;
+  if (mpiProgressThread) {
+    mpiThreadLevel = MPI_THREAD_MULTIPLE;
+  }
+  singleton::mpi().init(argc, argv, verbose, mpiThreadLevel);
+  if (mpiProgressThread) {
+    singleton::mpi().startProgressThread();
+  }
+#else
   singleton::mpi().init(argc, argv, verbose);
+#endif
 
 #ifdef PARALLEL_MODE_OMP
   singleton::omp().init(verbose);
@@ -44,6 +44,11 @@ ThreadPool& pool();
 /// Initialize OpenLB
 /**
  * Sets up MPI, thread pool and verifies platform requirements.
+ *
+ * Environment variables:
+ *   OLB_NUM_THREADS:         Number of ThreadPool threads
+ *   OLB_MPI_THREAD_LEVEL:    Required MPI thread level (single, funneled, serialized, multiple)
+ *   OLB_MPI_PROGRESS_THREAD: Start asynchronous MPI progress thread if 1 (implies multiple)
  **/
 void initialize(int *argc, char ***argv, bool multiOutput=false, bool verbose=true);
 /// Initialize OpenLB
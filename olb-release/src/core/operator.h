@@ -82,7 +82,20 @@ enum struct CollisionDispatchStrategy {
   /// Apply dominant dynamics using mask and fallback to virtual dispatch for others
   Dominant,
   /// Apply all dynamics individually (async for Platform::GPU_CUDA)
-  Individual
+  Individual,
+  /// Apply dominant non-trivial dynamics to a list of cells excluding NoDynamics (Platform::CPU_SISD)
+  /**
+   * Only skips trivial cells during collision, storage and propagation remain dense
+   **/
+  SkipTrivial
+};
+
+/// Loop schedule of CPU collision operators (only relevant for PARALLEL_MODE_OMP)
+enum struct CollisionLoopSchedule {
+  /// Hand out block slices one by one to idle threads
+  Dynamic,
+  /// Split block slices evenly between threads upfront
+  Static
 };
 
 /// Collision operation on concrete blocks of PLATFORM
@@ -97,12 +110,32 @@ struct BlockCollisionO : public AbstractCollisionO<T,DESCRIPTOR> {
   virtual void apply(ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block,
                      ConcreteBlockMask<T,PLATFORM>&               subdomain,
                      CollisionDispatchStrategy                    strategy) = 0;
+  /// Apply collision to cells, falling back to dynamic dispatch for cells of other dynamics
+  /**
+   * Used by CollisionDispatchStrategy::SkipTrivial, only implemented for Platform::CPU_SISD
+   **/
+  virtual void applyNonTrivial(ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block,
+                               const std::vector<CellID>&                   cells) {
+    throw std::runtime_error("CollisionDispatchStrategy::SkipTrivial is not supported by " + getName(PLATFORM));
+  }
 };
 
 /// Collision operation of concrete DYNAMICS on concrete block lattices of PLATFORM
 template<typename T, typename DESCRIPTOR, Platform PLATFORM, typename DYNAMICS>
 class ConcreteBlockCollisionO;
 
+/// Cell-wise operator applied immediately prior to the collision of a cell
+/**
+ * Used to fuse e.g. per-cell couplings into the collision loop of a block
+ * lattice s.t. the cell is processed while already in cache instead of
+ * requiring a separate pass over memory (see SuperLatticeCoupling::fuseIntoCollision).
+ **/
+struct AbstractFusedCellO {
+  virtual ~AbstractFusedCellO() = default;
+  /// Apply operator to cell iCell
+  virtual void apply(CellID iCell) = 0;
+};
+
 /// Base of block-wide coupling operators executed by SuperLatticeCoupling
 template <typename COUPLEES>
 struct AbstractCouplingO : public AbstractBlockO {
@@ -51,6 +51,21 @@ struct AbstractCyclicColumn {
   virtual       T& operator[](std::size_t i)       = 0;
 };
 
+/// Abstract declarator of sparse Column-like storage
+/**
+ * For fields that only carry non-default values on a small subset of
+ * cells (e.g. boundary distances). Unset rows read as the default value.
+ **/
+template <typename T>
+struct AbstractSparseColumn {
+  using value_type = T;
+
+  virtual std::size_t size() const = 0;
+
+  virtual const T& operator[](std::size_t i) const = 0;
+  virtual       T& operator[](std::size_t i)       = 0;
+};
+
 /// Specializable declarator for concrete implementations of abstract storage types
 template <typename ABSTRACT, Platform PLATFORM>
 struct ImplementationOf;
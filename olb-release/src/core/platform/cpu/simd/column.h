@@ -280,6 +280,15 @@ struct ImplementationOf<AbstractCyclicColumn<T>,Platform::CPU_SIMD> {
   using type = cpu::simd::CyclicColumn<T>;
 };
 
+/// Declare cpu::sisd::SparseColumn as the AbstractSparseColumn implementation for CPU SIMD targets
+/**
+ * Sparse fields are not accessed by vectorized collision operators
+ **/
+template <typename T>
+struct ImplementationOf<AbstractSparseColumn<T>,Platform::CPU_SIMD> {
+  using type = cpu::sisd::SparseColumn<T>;
+};
+
 
 template <typename T>
 class ConcreteCommunicatable<cpu::simd::CyclicColumn<T>> final : public Communicatable {
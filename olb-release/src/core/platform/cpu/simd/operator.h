@@ -345,6 +345,7 @@ private:
   }
 
   /// Apply collision on cell range [iCell,iCell+pack_size) of block
+  template <bool FUSED>
   void apply(ConcreteBlockLattice<T,DESCRIPTOR,Platform::CPU_SIMD>& block,
              ConcreteBlockMask<T,Platform::CPU_SIMD>&               subdomain,
              ConcreteBlockMask<T,Platform::CPU_SIMD>&               mask,
@@ -353,6 +354,13 @@ private:
              std::size_t                                            iCell)
   {
     if constexpr (dynamics::is_vectorizable_v<DYNAMICS>) {
+      if constexpr (FUSED) {
+        for (std::size_t i=iCell; i < iCell+cpu::simd::Pack<T>::size; ++i) {
+          if (subdomain[i]) {
+            block.applyFusedCollisionO(i);
+          }
+        }
+      }
       if (cpu::simd::Mask<T> m = {mask.raw(), iCell}) {
         cpu::simd::Cell<T,DESCRIPTOR,cpu::simd::Pack<T>,descriptors::POPULATION> cell(block, iCell, m);
         auto simdParameters = parameters.template copyAs<cpu::simd::Pack<T>>();
@@ -376,6 +384,54 @@ private:
     }
   }
 
+  /// Apply collision on entire block
+  /**
+   * FUSED selects whether fused collision operators are applied prior to each collision.
+   **/
+  template <bool FUSED>
+  void applyDominant(ConcreteBlockLattice<T,DESCRIPTOR,Platform::CPU_SIMD>& block,
+                     ConcreteBlockMask<T,Platform::CPU_SIMD>&               subdomain)
+  {
+    auto& mask = *_mask;
+    typename LatticeStatistics<T>::Aggregatable statistics{};
+    #ifdef PARALLEL_MODE_OMP
+    #pragma omp declare reduction(+ : typename LatticeStatistics<T>::Aggregatable : omp_out += omp_in) initializer (omp_priv={})
+    #endif
+
+    if constexpr (dynamics::is_vectorizable_v<DYNAMICS>) {
+      // Ensure that serialized mask storage is up-to-date
+      mask.setProcessingContext(ProcessingContext::Simulation);
+      // Apply collision to cells
+      #ifdef PARALLEL_MODE_OMP
+      #pragma omp parallel for schedule(static) reduction(+ : statistics)
+      #endif
+      for (CellID iCell=0; iCell < block.getNcells(); iCell += cpu::simd::Pack<T>::size) {
+        apply<FUSED>(block, subdomain, mask, *_parameters, statistics, iCell);
+      }
+    } else { // Fallback for non-vectorizable collision operators
+      #ifdef PARALLEL_MODE_OMP
+      #pragma omp parallel for schedule(static) reduction(+ : statistics)
+      #endif
+      for (std::size_t iCell=0; iCell < block.getNcells(); ++iCell) {
+        if constexpr (FUSED) {
+          if (subdomain[iCell]) {
+            block.applyFusedCollisionO(iCell);
+          }
+        }
+        if (mask[iCell]) {
+          cpu::Cell<T,DESCRIPTOR,Platform::CPU_SIMD> cell(block, iCell);
+          if (auto cellStatistic = DYNAMICS().collide(cell, *_parameters)) {
+            statistics.increment(cellStatistic.rho, cellStatistic.uSqr);
+          }
+        } else if (subdomain[iCell]) {
+          applyOther(block, statistics, iCell);
+        }
+      }
+    }
+
+    block.getStatistics().incrementStats(statistics);
+  }
+
 public:
   ConcreteBlockCollisionO():
     _dynamics(new DYNAMICS()),
@@ -432,40 +488,11 @@ public:
     if (strategy != CollisionDispatchStrategy::Dominant) {
       throw std::runtime_error("Platform::CPU_SIMD currently only support CollisionDispatchStrategy::Dominant");
     }
-
-    auto& mask = *_mask;
-    typename LatticeStatistics<T>::Aggregatable statistics{};
-    #ifdef PARALLEL_MODE_OMP
-    #pragma omp declare reduction(+ : typename LatticeStatistics<T>::Aggregatable : omp_out += omp_in) initializer (omp_priv={})
-    #endif
-
-    if constexpr (dynamics::is_vectorizable_v<DYNAMICS>) {
-      // Ensure that serialized mask storage is up-to-date
-      mask.setProcessingContext(ProcessingContext::Simulation);
-      // Apply collision to cells
-      #ifdef PARALLEL_MODE_OMP
-      #pragma omp parallel for schedule(static) reduction(+ : statistics)
-      #endif
-      for (CellID iCell=0; iCell < block.getNcells(); iCell += cpu::simd::Pack<T>::size) {
-        apply(block, subdomain, mask, *_parameters, statistics, iCell);
-      }
-    } else { // Fallback for non-vectorizable collision operators
-      #ifdef PARALLEL_MODE_OMP
-      #pragma omp parallel for schedule(static) reduction(+ : statistics)
-      #endif
-      for (std::size_t iCell=0; iCell < block.getNcells(); ++iCell) {
-        if (mask[iCell]) {
-          cpu::Cell<T,DESCRIPTOR,Platform::CPU_SIMD> cell(block, iCell);
-          if (auto cellStatistic = DYNAMICS().collide(cell, *_parameters)) {
-            statistics.increment(cellStatistic.rho, cellStatistic.uSqr);
-          }
-        } else if (subdomain[iCell]) {
-          applyOther(block, statistics, iCell);
-        }
-      }
+    if (block.hasFusedCollisionO()) {
+      applyDominant<true>(block, subdomain);
+    } else {
+      applyDominant<false>(block, subdomain);
     }
-
-    block.getStatistics().incrementStats(statistics);
   }
 
 };
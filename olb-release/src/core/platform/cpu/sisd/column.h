@@ -27,6 +27,11 @@
 
 #include <memory>
 #include <array>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <limits>
+#include <cstring>
 #include <stdexcept>
 
 #include "core/platform/platform.h"
@@ -220,6 +225,272 @@ public:
 
 };
 
+
+/// Cell to slot index shared by the columns of a sparse field
+/**
+ * Rows are assigned slots on first mutable access. Lookups are lock-free
+ * so that operators may access sparse fields concurrently, only the
+ * assignment of new slots is serialized.
+ **/
+class SparseColumnIndex {
+private:
+  std::size_t _count;
+  std::unique_ptr<std::atomic<std::uint32_t>[]> _slots;
+  /// Row of each assigned slot
+  std::vector<std::size_t> _rows;
+  std::atomic<std::size_t> _nSlots;
+  std::mutex _mutex;
+
+public:
+  static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+
+  SparseColumnIndex(std::size_t count):
+    _count(count),
+    _slots(new std::atomic<std::uint32_t>[count]),
+    _nSlots(0)
+  {
+    if (count >= none) {
+      throw std::invalid_argument("Sparse column index exceeds 32bit slot range");
+    }
+    for (std::size_t i=0; i < count; ++i) {
+      _slots[i].store(none, std::memory_order_relaxed);
+    }
+  }
+
+  std::size_t size() const
+  {
+    return _count;
+  }
+
+  /// Number of assigned slots
+  std::size_t slots() const
+  {
+    return _nSlots.load(std::memory_order_acquire);
+  }
+
+  /// Row of slot
+  std::size_t row(std::size_t slot) const
+  {
+    return _rows[slot];
+  }
+
+  /// Return slot of row i or none if unassigned
+  std::uint32_t find(std::size_t i) const
+  {
+    return _slots[i].load(std::memory_order_acquire);
+  }
+
+  /// Return slot of row i, assign new slot if required
+  std::uint32_t allocate(std::size_t i)
+  {
+    std::uint32_t slot = find(i);
+    if (slot == none) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      slot = _slots[i].load(std::memory_order_relaxed);
+      if (slot == none) {
+        slot = _rows.size();
+        _rows.emplace_back(i);
+        _nSlots.store(_rows.size(), std::memory_order_release);
+        _slots[i].store(slot, std::memory_order_release);
+      }
+    }
+    return slot;
+  }
+
+  void resize(std::size_t count)
+  {
+    if (count < _count) {
+      throw std::logic_error("Sparse column can not be shrunk");
+    } else if (count > _count) {
+      if (count >= none) {
+        throw std::invalid_argument("Sparse column index exceeds 32bit slot range");
+      }
+      std::unique_ptr<std::atomic<std::uint32_t>[]> slots(new std::atomic<std::uint32_t>[count]);
+      for (std::size_t i=0; i < count; ++i) {
+        slots[i].store(i < _count ? find(i) : none, std::memory_order_relaxed);
+      }
+      _slots.swap(slots);
+      _count = count;
+    }
+  }
+
+  std::mutex& mutex()
+  {
+    return _mutex;
+  }
+
+};
+
+/// Sparse column for fields that are only set on few rows
+/**
+ * Values are stored in chunks of compact slots assigned via a (possibly
+ * shared) SparseColumnIndex. Const access of unset rows returns the
+ * default value without assigning a slot.
+ **/
+template<typename T>
+class SparseColumn final : public AbstractSparseColumn<T>
+                         , public Serializable {
+private:
+  static constexpr std::size_t chunk_size = 256;
+
+  std::shared_ptr<SparseColumnIndex> _index;
+  T _default;
+
+  std::size_t _nChunks;
+  std::unique_ptr<std::atomic<T*>[]> _chunks;
+
+  /// Staging buffers for the serializable interface
+  std::size_t _serialCount;
+  std::size_t _serialSlots;
+  std::vector<std::size_t> _serialRows;
+  std::vector<T> _serialData;
+
+  T* getChunk(std::size_t iChunk)
+  {
+    T* chunk = _chunks[iChunk].load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+      std::lock_guard<std::mutex> lock(_index->mutex());
+      chunk = _chunks[iChunk].load(std::memory_order_relaxed);
+      if (chunk == nullptr) {
+        chunk = new T[chunk_size];
+        std::fill(chunk, chunk + chunk_size, _default);
+        _chunks[iChunk].store(chunk, std::memory_order_release);
+      }
+    }
+    return chunk;
+  }
+
+  void clear()
+  {
+    if (_chunks) {
+      for (std::size_t iChunk=0; iChunk < _nChunks; ++iChunk) {
+        delete[] _chunks[iChunk].load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+public:
+  using value_t = T;
+
+  SparseColumn(std::size_t count):
+    _index(new SparseColumnIndex(count)),
+    _default{},
+    _nChunks((count + chunk_size - 1) / chunk_size),
+    _chunks(new std::atomic<T*>[_nChunks]),
+    _serialCount(0),
+    _serialSlots(0)
+  {
+    for (std::size_t iChunk=0; iChunk < _nChunks; ++iChunk) {
+      _chunks[iChunk].store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  SparseColumn():
+    SparseColumn(0)
+  { }
+
+  SparseColumn(SparseColumn<T>&& rhs):
+    _index(std::move(rhs._index)),
+    _default(rhs._default),
+    _nChunks(rhs._nChunks),
+    _chunks(std::move(rhs._chunks)),
+    _serialCount(0),
+    _serialSlots(0)
+  {
+    rhs._nChunks = 0;
+  }
+
+  ~SparseColumn()
+  {
+    clear();
+  }
+
+  /// Share row to slot assignment with another column of the same size
+  /**
+   * Must be called prior to any assignments, used to store all components
+   * of a field using a single index.
+   **/
+  void shareIndex(const SparseColumn<T>& rhs)
+  {
+    if (rhs.size() != size() || _index->slots() > 0) {
+      throw std::logic_error("Sparse column index may only be shared by fresh columns of equal size");
+    }
+    _index = rhs._index;
+  }
+
+  /// Set value returned for unassigned rows
+  void setDefault(const T& value)
+  {
+    _default = value;
+  }
+
+  const T& getDefault() const
+  {
+    return _default;
+  }
+
+  /// Number of rows holding actual storage
+  std::size_t getNslots() const
+  {
+    return _index->slots();
+  }
+
+  /// Set value of row i, rows at default value are only touched if already assigned
+  void set(std::size_t i, const T& value)
+  {
+    if (!(value == _default) || _index->find(i) != SparseColumnIndex::none) {
+      operator[](i) = value;
+    }
+  }
+
+  void resize(std::size_t count)
+  {
+    _index->resize(count);
+    const std::size_t nChunks = (count + chunk_size - 1) / chunk_size;
+    if (nChunks > _nChunks) {
+      std::unique_ptr<std::atomic<T*>[]> chunks(new std::atomic<T*>[nChunks]);
+      for (std::size_t iChunk=0; iChunk < nChunks; ++iChunk) {
+        chunks[iChunk].store(iChunk < _nChunks ? _chunks[iChunk].load() : nullptr,
+                             std::memory_order_relaxed);
+      }
+      _chunks.swap(chunks);
+      _nChunks = nChunks;
+    }
+  }
+
+  const T& operator[](std::size_t i) const override
+  {
+    const std::uint32_t slot = _index->find(i);
+    if (slot != SparseColumnIndex::none) {
+      if (const T* chunk = _chunks[slot / chunk_size].load(std::memory_order_acquire)) {
+        return chunk[slot % chunk_size];
+      }
+    }
+    return _default;
+  }
+
+  T& operator[](std::size_t i) override
+  {
+    const std::uint32_t slot = _index->allocate(i);
+    return getChunk(slot / chunk_size)[slot % chunk_size];
+  }
+
+  std::size_t size() const override
+  {
+    return _index->size();
+  }
+
+  void setProcessingContext(ProcessingContext) { };
+
+  /// Number of data blocks for the serializable interface
+  std::size_t getNblock() const override;
+  /// Binary size for the serializer
+  std::size_t getSerializableSize() const override;
+  /// Return a pointer to the memory of the current block and its size for the serializable interface
+  bool* getBlock(std::size_t iBlock, std::size_t& sizeBlock, bool loadingMode) override;
+  void postLoad() override;
+
+};
 }
 
 }
@@ -236,6 +507,59 @@ struct ImplementationOf<AbstractCyclicColumn<T>,Platform::CPU_SISD> {
   using type = cpu::sisd::CyclicColumn<T>;
 };
 
+/// Declare cpu::sisd::SparseColumn as the AbstractSparseColumn implementation for CPU SISD targets
+template <typename T>
+struct ImplementationOf<AbstractSparseColumn<T>,Platform::CPU_SISD> {
+  using type = cpu::sisd::SparseColumn<T>;
+};
+
+template <typename T>
+class ConcreteCommunicatable<cpu::sisd::SparseColumn<T>> final : public Communicatable {
+private:
+  cpu::sisd::SparseColumn<T>& _column;
+
+public:
+  ConcreteCommunicatable(cpu::sisd::SparseColumn<T>& column):
+    _column{column} { }
+
+  /// Get serialized size for data at locations `indices`
+  std::size_t size(ConstSpan<CellID> indices) const override
+  {
+    return indices.size() * sizeof(T);
+  }
+
+  /// Serialize data at locations `indices` to `buffer`
+  std::size_t serialize(ConstSpan<CellID> indices,
+                        std::uint8_t* buffer) const override
+  {
+    const auto& column = static_cast<const cpu::sisd::SparseColumn<T>&>(_column);
+    std::uint8_t* target = buffer;
+    for (CellID index : indices) {
+      std::memcpy(target, reinterpret_cast<const void*>(&column[index]), sizeof(T));
+      target += sizeof(T);
+    }
+    return indices.size() * sizeof(T);
+  }
+
+  /// Deserialize data at locations `indices` to `buffer`
+  /**
+   * Rows receiving the default value are not assigned storage
+   **/
+  std::size_t deserialize(ConstSpan<CellID> indices,
+                          const std::uint8_t* buffer) override
+  {
+    const std::uint8_t* source = buffer;
+    T value;
+    for (CellID index : indices) {
+      std::memcpy(reinterpret_cast<void*>(&value), source, sizeof(T));
+      _column.set(index, value);
+      source += sizeof(T);
+    }
+    return indices.size() * sizeof(T);
+  }
+
+};
+
 /// Use CPU SISD as default Column
 template <typename T>
 using Column = cpu::sisd::Column<T>;
@@ -88,6 +88,61 @@ bool* CyclicColumn<T>::getBlock(std::size_t iBlock, std::size_t& sizeBlock, bool
   return dataPtr;
 }
 
+
+template<typename T>
+std::size_t SparseColumn<T>::getNblock() const
+{
+  return 4;
+}
+
+template<typename T>
+std::size_t SparseColumn<T>::getSerializableSize() const
+{
+  return 2 * sizeof(std::size_t) + getNslots() * (sizeof(std::size_t) + sizeof(T));
+}
+
+template<typename T>
+bool* SparseColumn<T>::getBlock(std::size_t iBlock, std::size_t& sizeBlock, bool loadingMode)
+{
+  std::size_t currentBlock = 0;
+  bool* dataPtr = nullptr;
+
+  if (!loadingMode && iBlock == 0) {
+    _serialCount = size();
+    _serialSlots = getNslots();
+    _serialRows.resize(_serialSlots);
+    _serialData.resize(_serialSlots);
+    const auto& column = static_cast<const SparseColumn<T>&>(*this);
+    for (std::size_t iSlot=0; iSlot < _serialSlots; ++iSlot) {
+      _serialRows[iSlot] = _index->row(iSlot);
+      _serialData[iSlot] = column[_serialRows[iSlot]];
+    }
+  }
+
+  registerVar(iBlock, sizeBlock, currentBlock, dataPtr, _serialCount);
+  registerVar(iBlock, sizeBlock, currentBlock, dataPtr, _serialSlots);
+  if (loadingMode && iBlock == 2) {
+    _serialRows.resize(_serialSlots);
+    _serialData.resize(_serialSlots);
+  }
+  registerVar(iBlock, sizeBlock, currentBlock, dataPtr, *_serialRows.data(), _serialSlots);
+  registerVar(iBlock, sizeBlock, currentBlock, dataPtr, *_serialData.data(), _serialSlots);
+
+  return dataPtr;
+}
+
+template<typename T>
+void SparseColumn<T>::postLoad()
+{
+  if (_serialCount > size()) {
+    resize(_serialCount);
+  }
+  for (std::size_t iSlot=0; iSlot < _serialSlots; ++iSlot) {
+    operator[](_serialRows[iSlot]) = _serialData[iSlot];
+  }
+  _serialRows.clear();
+  _serialData.clear();
+}
 }
 
 }
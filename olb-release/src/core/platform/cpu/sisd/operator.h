@@ -139,7 +139,9 @@ private:
   /// Apply DYNAMICS using its mask and fall back to dynamic dispatch for others
   /**
    * Loop excludes overlap areas of block as collisions are never applied there.
+   * FUSED selects whether fused collision operators are applied prior to each collision.
    **/
+  template <bool FUSED>
   void applyDominant(ConcreteBlockLattice<T,DESCRIPTOR,Platform::CPU_SISD>& block,
                      ConcreteBlockMask<T,Platform::CPU_SISD>&               subdomain)
   {
@@ -153,12 +155,15 @@ private:
     if constexpr (DESCRIPTOR::d == 3) {
       if (block.statisticsEnabled()) {
         #ifdef PARALLEL_MODE_OMP
-        #pragma omp parallel for schedule(dynamic,1) reduction(+ : statistics)
+        #pragma omp parallel for schedule(runtime) reduction(+ : statistics)
         #endif
         for (int iX=0; iX < block.getNx(); ++iX) {
           for (int iY=0; iY < block.getNy(); ++iY) {
             std::size_t iCell = block.getCellId(iX,iY,0);
             for (int iZ=0; iZ < block.getNz(); ++iZ) {
+              if constexpr (FUSED) {
+                block.applyFusedCollisionO(iCell);
+              }
               cpu::Cell<T,DESCRIPTOR,Platform::CPU_SISD> cell(block, iCell);
               if (auto cellStatistic = mask[iCell] ? DYNAMICS().collide(cell, parameters)
                                                    : _dynamicsOfCells[iCell]->collide(cell)) {
@@ -170,12 +175,15 @@ private:
         }
       } else {
         #ifdef PARALLEL_MODE_OMP
-        #pragma omp parallel for schedule(dynamic,1)
+        #pragma omp parallel for schedule(runtime)
         #endif
         for (int iX=0; iX < block.getNx(); ++iX) {
           for (int iY=0; iY < block.getNy(); ++iY) {
             std::size_t iCell = block.getCellId(iX,iY,0);
             for (int iZ=0; iZ < block.getNz(); ++iZ) {
+              if constexpr (FUSED) {
+                block.applyFusedCollisionO(iCell);
+              }
               cpu::Cell<T,DESCRIPTOR,Platform::CPU_SISD> cell(block, iCell);
               if (mask[iCell]) [[likely]] {
                 DYNAMICS().collide(cell, parameters);
@@ -190,11 +198,14 @@ private:
     } else {
       if (block.statisticsEnabled()) {
         #ifdef PARALLEL_MODE_OMP
-        #pragma omp parallel for schedule(dynamic,1) reduction(+ : statistics)
+        #pragma omp parallel for schedule(runtime) reduction(+ : statistics)
         #endif
         for (int iX=0; iX < block.getNx(); ++iX) {
           std::size_t iCell = block.getCellId(iX,0);
           for (int iY=0; iY < block.getNy(); ++iY) {
+            if constexpr (FUSED) {
+              block.applyFusedCollisionO(iCell);
+            }
             cpu::Cell<T,DESCRIPTOR,Platform::CPU_SISD> cell(block, iCell);
             if (auto cellStatistic = mask[iCell] ? DYNAMICS().collide(cell, parameters)
                                                  : _dynamicsOfCells[iCell]->collide(cell)) {
@@ -205,11 +216,14 @@ private:
         }
       } else {
         #ifdef PARALLEL_MODE_OMP
-        #pragma omp parallel for schedule(dynamic,1)
+        #pragma omp parallel for schedule(runtime)
         #endif
         for (int iX=0; iX < block.getNx(); ++iX) {
           std::size_t iCell = block.getCellId(iX,0);
           for (int iY=0; iY < block.getNy(); ++iY) {
+            if constexpr (FUSED) {
+              block.applyFusedCollisionO(iCell);
+            }
             cpu::Cell<T,DESCRIPTOR,Platform::CPU_SISD> cell(block, iCell);
             if (mask[iCell]) [[likely]] {
               DYNAMICS().collide(cell, parameters);
@@ -228,6 +242,7 @@ private:
   }
 
   /// Apply only DYNAMICS, do not apply others
+  template <bool FUSED>
   void applyIndividual(ConcreteBlockLattice<T,DESCRIPTOR,Platform::CPU_SISD>& block,
                        ConcreteBlockMask<T,Platform::CPU_SISD>&               subdomain)
   {
@@ -254,6 +269,9 @@ private:
     #endif
     for (std::size_t i=0; i < _cells.size(); ++i) {
       std::size_t iCell = _cells[i];
+      if constexpr (FUSED) {
+        block.applyFusedCollisionO(iCell);
+      }
       cpu::Cell<T,DESCRIPTOR,Platform::CPU_SISD> cell(block, iCell);
       if (auto cellStatistic = DYNAMICS().collide(cell, parameters)) {
         statistics.increment(cellStatistic.rho, cellStatistic.uSqr);
@@ -263,6 +281,54 @@ private:
     block.getStatistics().incrementStats(statistics);
   }
 
+  /// Apply DYNAMICS on the listed cells and fall back to dynamic dispatch for others
+  template <bool FUSED>
+  void applyCells(ConcreteBlockLattice<T,DESCRIPTOR,Platform::CPU_SISD>& block,
+                  const std::vector<CellID>&                             cells)
+  {
+    auto& parameters = *_parameters;
+    auto& mask = *_mask;
+    typename LatticeStatistics<T>::Aggregatable statistics{};
+
+    #ifdef PARALLEL_MODE_OMP
+    #pragma omp declare reduction(+ : typename LatticeStatistics<T>::Aggregatable : omp_out += omp_in) initializer (omp_priv={})
+    #endif
+
+    if (block.statisticsEnabled()) {
+      #ifdef PARALLEL_MODE_OMP
+      #pragma omp parallel for schedule(runtime) reduction(+ : statistics)
+      #endif
+      for (std::size_t i=0; i < cells.size(); ++i) {
+        const std::size_t iCell = cells[i];
+        if constexpr (FUSED) {
+          block.applyFusedCollisionO(iCell);
+        }
+        cpu::Cell<T,DESCRIPTOR,Platform::CPU_SISD> cell(block, iCell);
+        if (auto cellStatistic = mask[iCell] ? DYNAMICS().collide(cell, parameters)
+                                             : _dynamicsOfCells[iCell]->collide(cell)) {
+          statistics.increment(cellStatistic.rho, cellStatistic.uSqr);
+        }
+      }
+      block.getStatistics().incrementStats(statistics);
+    } else {
+      #ifdef PARALLEL_MODE_OMP
+      #pragma omp parallel for schedule(runtime)
+      #endif
+      for (std::size_t i=0; i < cells.size(); ++i) {
+        const std::size_t iCell = cells[i];
+        if constexpr (FUSED) {
+          block.applyFusedCollisionO(iCell);
+        }
+        cpu::Cell<T,DESCRIPTOR,Platform::CPU_SISD> cell(block, iCell);
+        if (mask[iCell]) [[likely]] {
+          DYNAMICS().collide(cell, parameters);
+        } else {
+          _dynamicsOfCells[iCell]->collide(cell);
+        }
+      }
+    }
+  }
+
 public:
   ConcreteBlockCollisionO():
     _dynamics(new DYNAMICS()),
@@ -322,16 +388,33 @@ public:
              ConcreteBlockMask<T,Platform::CPU_SISD>&               subdomain,
              CollisionDispatchStrategy                              strategy) override
   {
+    const bool fused = block.hasFusedCollisionO();
     switch (strategy) {
     case CollisionDispatchStrategy::Dominant:
-      return applyDominant(block, subdomain);
+      return fused ? applyDominant<true>(block, subdomain)
+                   : applyDominant<false>(block, subdomain);
     case CollisionDispatchStrategy::Individual:
-      return applyIndividual(block, subdomain);
+      return fused ? applyIndividual<true>(block, subdomain)
+                   : applyIndividual<false>(block, subdomain);
     default:
       throw std::runtime_error("Invalid collision dispatch strategy");
     }
   }
 
+  /// Apply DYNAMICS using its mask on the given cells and fall back to dynamic dispatch for others
+  /**
+   * Cells not contained in the list (e.g. NoDynamics) are not visited at all.
+   **/
+  void applyNonTrivial(ConcreteBlockLattice<T,DESCRIPTOR,Platform::CPU_SISD>& block,
+                       const std::vector<CellID>&                             cells) override
+  {
+    if (block.hasFusedCollisionO()) {
+      applyCells<true>(block, cells);
+    } else {
+      applyCells<false>(block, cells);
+    }
+  }
+
 };
 
 
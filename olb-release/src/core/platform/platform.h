@@ -27,6 +27,7 @@
 
 #include <cstdint>
 #include <stdexcept>
+#include <string>
 
 /// Top level namespace for all of OpenLB
 namespace olb {
@@ -99,6 +100,20 @@ constexpr bool isPlatformCPU(Platform platform) {
   }
 }
 
+/// Returns name of platform
+inline std::string getName(Platform platform) {
+  switch (platform) {
+  case Platform::CPU_SISD:
+    return "CPU_SISD";
+  case Platform::CPU_SIMD:
+    return "CPU_SIMD";
+  case Platform::GPU_CUDA:
+    return "GPU_CUDA";
+  default:
+    throw std::invalid_argument("Invalid PLATFORM");
+  }
+}
+
 }
 
 #endif
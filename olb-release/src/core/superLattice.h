@@ -32,6 +32,8 @@
 #include "cellD.h"
 #include "blockLattice.hh"
 #include "communication/superCommunicator.h"
+#include "taskGraph.h"
+#include "superStagePipeline.h"
 #include "postProcessing.hh"
 #include "serializer.h"
 #include "communication/superStructure.hh"
@@ -40,6 +42,21 @@
 
 namespace olb {
 
+/// Execution strategy of the block-local stages of SuperLattice::collideAndStream
+enum struct BlockExecutionStrategy {
+  /// Stages are processed for all blocks in turn (using OpenMP tasks if enabled)
+  Barrier,
+  /// Stages of each block are scheduled as a TaskGraph on the ThreadPool
+  /**
+   * Blocks only wait for their neighbors instead of all blocks. Should not be
+   * combined with OpenMP-parallel collision loops inside of blocks.
+   *
+   * In MPI builds the overlap communication of each block is performed by
+   * separate tasks that poll for the completion of their receives, i.e.
+   * MPI must provide MPI_THREAD_MULTIPLE (c.f. OLB_MPI_THREAD_LEVEL).
+   **/
+  TaskGraph
+};
 
 /// Super class maintaining block lattices for a cuboid decomposition
 template <typename T, typename DESCRIPTOR>
@@ -50,12 +67,24 @@ private:
   std::optional<const UnitConverter<T,DESCRIPTOR>*> _converter;
   /// Lattices with ghost cell layer of size overlap
   std::vector<std::unique_ptr<BlockLattice<T,DESCRIPTOR>>> _block;
+#ifdef PARALLEL_MODE_MPI
+  /// Send and receive buffers shared by all communicators (must outlive them)
+  MpiBufferArena _communicationBufferArena;
+#endif
   /// Communicators for stages of collideAndStream
   std::map<std::type_index,std::unique_ptr<SuperCommunicator<T,SuperLattice>>> _communicator;
   /// True if there are changes to be communicated using manually-triggered Full stage
   bool _communicationNeeded;
+  /// Execution strategy of the block-local stages of collideAndStream
+  BlockExecutionStrategy _blockExecutionStrategy = BlockExecutionStrategy::Barrier;
+  /// Task graph of the block-local stages for BlockExecutionStrategy::TaskGraph
+  std::unique_ptr<TaskGraph> _blockTaskGraph;
+  /// Revisions of the PostCollide and PostStream communicators _blockTaskGraph was built for
+  std::array<std::size_t,2> _blockTaskGraphRevision{};
   /// Map of custom stages and associated tasks
   std::map<std::type_index,std::vector<std::function<void()>>> _customTasks;
+  /// Fused sequences of post processor stages
+  std::map<std::type_index,std::unique_ptr<SuperStagePipeline<T,DESCRIPTOR>>> _stagePipelines;
   /// Map of custom background stages and any associated one-off tasks
   std::map<std::type_index,std::vector<std::future<void>>> _backgroundTasks;
 
@@ -68,6 +97,14 @@ private:
   bool _statisticsEnabled;
   /// Aggregate global statistics
   void collectStatistics();
+  /// Construct task graph of executeBlockTaskGraph for the current communication neighborhood
+  void buildBlockTaskGraph();
+  /// Collide, stream and execute PostCollide resp. PostStream post processors using a TaskGraph
+  /**
+   * Communication is performed per block. The graph is only rebuilt if the
+   * requests of the involved communicators were re-exchanged.
+   **/
+  void executeBlockTaskGraph();
   /// False iff initialize was not yet called
   bool _initialized = false;
 
@@ -180,8 +217,27 @@ public:
   /// Return communicator for given communication stage
   template <typename STAGE>
   SuperCommunicator<T,SuperLattice>& getCommunicator(STAGE stage=STAGE());
+#ifdef PARALLEL_MODE_MPI
+  /// Return arena providing the send and receive buffers of all communicators
+  MpiBufferArena& getCommunicationBufferArena() {
+    return _communicationBufferArena;
+  }
+#endif
   /// Perform full overlap communication if needed
   void communicate() override;
+  /// Restrict PostCollide communication to the populations streaming into neighboring blocks
+  /**
+   * Only populations whose discrete velocity points from the overlap into
+   * the core are exchanged prior to propagation (e.g. 5 of 19 per face for
+   * D3Q19). All other overlap populations are no longer updated, i.e.
+   * operators accessing populations of neighbors in the overlap must request
+   * their own communication (which is also the case if the default is kept).
+   *
+   * Replaces the PostCollide communicator, call prior to any further
+   * PostCollide communication requests (e.g. by boundary setters).
+   * Requires all blocks to be processed on CPU platforms.
+   **/
+  void filterPropagationCommunication();
 
   /// Return a handle to the LatticeStatistics object
   LatticeStatistics<T>& getStatistics();
@@ -378,6 +434,23 @@ public:
    * 8. Reset lattice statistics and mark overlap state as unclean
    **/
   void collideAndStream();
+  /// First half of collideAndStream up to the start of the post-collision communication
+  /**
+   * Together with endCollideAndStream this allows for overlapping the post-collision
+   * communication with other work, e.g. of further lattices (c.f. SuperLatticeEnsemble,
+   * SuperLatticeHierarchy). For BlockExecutionStrategy::TaskGraph all block-local
+   * stages are already processed here.
+   **/
+  void beginCollideAndStream();
+  /// Second half of collideAndStream, to be called after beginCollideAndStream
+  void endCollideAndStream();
+
+  /// Set execution strategy of the block-local stages of collideAndStream
+  /**
+   * BlockExecutionStrategy::TaskGraph requires all local blocks to use a CPU platform
+   * and, in MPI builds, MPI_THREAD_MULTIPLE
+   **/
+  void setBlockExecutionStrategy(BlockExecutionStrategy strategy);
 
   /// Subtract constant offset from the density
   void stripeOffDensityOffset(T offset);
@@ -418,6 +491,13 @@ public:
   template <typename STAGE=stage::PostStream>
   void executePostProcessors(STAGE stage=STAGE());
 
+  /// Return pipeline of fused post processor stages for given PIPELINE tag
+  template <typename PIPELINE>
+  SuperStagePipeline<T,DESCRIPTOR>& getStagePipeline(PIPELINE pipeline=PIPELINE());
+  /// Executes all stages of PIPELINE (c.f. SuperStagePipeline)
+  template <typename PIPELINE>
+  void executeStagePipeline(PIPELINE pipeline=PIPELINE());
+
   /// Schedules f for execution during every invocation of STAGE
   template <typename STAGE>
   void addCustomTask(std::function<void()> f) {
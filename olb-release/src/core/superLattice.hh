@@ -600,6 +600,13 @@ void SuperLattice<T,DESCRIPTOR>::iniRegularized(SuperGeometry<T,DESCRIPTOR::d>&
 
 template<typename T, typename DESCRIPTOR>
 void SuperLattice<T,DESCRIPTOR>::collideAndStream()
+{
+  beginCollideAndStream();
+  endCollideAndStream();
+}
+
+template<typename T, typename DESCRIPTOR>
+void SuperLattice<T,DESCRIPTOR>::beginCollideAndStream()
 {
   if (!_initialized) [[unlikely]] {
     initialize();
@@ -621,23 +628,51 @@ void SuperLattice<T,DESCRIPTOR>::collideAndStream()
   // (used for multi-stage models such as bubble model)
   executeCustomTasks(PreCollide());
 
-  #ifdef PARALLEL_MODE_OMP
-  #pragma omp taskloop
-  #endif
-  for (int iC = 0; iC < load.size(); ++iC) {
-    _block[iC]->collide();
-  }
+  if (_blockExecutionStrategy == BlockExecutionStrategy::TaskGraph) {
+    executeBlockTaskGraph();
+  } else {
+    #ifdef PARALLEL_MODE_OMP
+    #pragma omp taskloop
+    #endif
+    for (int iC = 0; iC < load.size(); ++iC) {
+      _block[iC]->collide();
+    }
 
-  // Communicate propagation overlap, optional post processing
-  executePostProcessors(PostCollide());
+    #ifdef PLATFORM_GPU_CUDA
+    gpu::cuda::device::synchronize();
+    #endif
 
-  // Block-local propagation
-  for (int iC = 0; iC < load.size(); ++iC) {
-    _block[iC]->stream();
+    // Communicate propagation overlap
+    getCommunicator(PostCollide()).startCommunication();
   }
+}
 
-  // Communicate (default) post processor neighborhood and apply them
-  executePostProcessors(PostStream());
+template<typename T, typename DESCRIPTOR>
+void SuperLattice<T,DESCRIPTOR>::endCollideAndStream()
+{
+  using namespace stage;
+
+  if (_blockExecutionStrategy != BlockExecutionStrategy::TaskGraph) {
+    auto& load = this->_loadBalancer;
+
+    getCommunicator(PostCollide()).finishCommunication();
+
+    // Optional post processing
+    #ifdef PARALLEL_MODE_OMP
+    #pragma omp taskloop
+    #endif
+    for (int iC = 0; iC < load.size(); ++iC) {
+      _block[iC]->template postProcess<PostCollide>();
+    }
+
+    // Block-local propagation
+    for (int iC = 0; iC < load.size(); ++iC) {
+      _block[iC]->stream();
+    }
+
+    // Communicate (default) post processor neighborhood and apply them
+    executePostProcessors(PostStream());
+  }
 
   // Execute custom tasks (arbitrary callables)
   // (used for multi-stage models such as free surface)
@@ -662,6 +697,140 @@ void SuperLattice<T,DESCRIPTOR>::collideAndStream()
 #endif
 }
 
+template<typename T, typename DESCRIPTOR>
+void SuperLattice<T,DESCRIPTOR>::buildBlockTaskGraph()
+{
+  using namespace stage;
+  auto& load = this->_loadBalancer;
+
+  _blockTaskGraph = std::make_unique<TaskGraph>();
+  auto& graph = *_blockTaskGraph;
+
+  // Adds communication of the overlap for all blocks after producers and
+  // returns the block-modifying consumer tasks of the communicated data
+  auto addCommunication = [&](auto& communicator,
+                              const std::vector<TaskGraph::id_t>& producers,
+                              auto consume) -> std::vector<TaskGraph::id_t> {
+    std::vector<TaskGraph::id_t> communication(load.size());
+    std::vector<TaskGraph::id_t> consumers(load.size());
+    for (int iC = 0; iC < load.size(); ++iC) {
+#ifdef PARALLEL_MODE_MPI
+      // Sends the core of iC and copies the cores of local sources into its overlap
+      communication[iC] = graph.add([&communicator,iC]() {
+        communicator.send(iC);
+      });
+      auto receive = graph.add([&communicator,iC]() {
+        communicator.receive(iC);
+      });
+      auto unpack = graph.addPolling([&communicator,iC]() {
+        return communicator.tryUnpack(iC);
+      });
+      graph.addDependency(unpack, receive);
+      graph.addDependency(unpack, communication[iC]);
+      // Send buffers must not be re-used before completion
+      auto wait = graph.addPolling([&communicator,iC]() {
+        return communicator.tryWait(iC);
+      });
+      graph.addDependency(wait, communication[iC]);
+#else
+      communication[iC] = graph.add([&communicator,iC]() {
+        communicator.communicate(iC);
+      });
+#endif
+      graph.addDependency(communication[iC], producers[iC]);
+      consumers[iC] = graph.add([consume,iC]() {
+        consume(iC);
+      });
+#ifdef PARALLEL_MODE_MPI
+      graph.addDependency(consumers[iC], unpack);
+#else
+      graph.addDependency(consumers[iC], communication[iC]);
+#endif
+    }
+    for (int iC = 0; iC < load.size(); ++iC) {
+      communicator.forSourcesOf(iC, [&](int jC) {
+        // Data of jC must be produced before and not modified during its communication to iC
+        graph.addDependency(communication[iC], producers[jC]);
+        graph.addDependency(consumers[jC], communication[iC]);
+      });
+    }
+    return consumers;
+  };
+
+  std::vector<TaskGraph::id_t> collision(load.size());
+  for (int iC = 0; iC < load.size(); ++iC) {
+    collision[iC] = graph.add([this,iC]() {
+      _block[iC]->collide();
+    });
+  }
+
+  // Communicate propagation overlap, optional post processing
+  auto postCollide = addCommunication(getCommunicator(PostCollide()), collision, [this](int iC) {
+    _block[iC]->template postProcess<PostCollide>();
+  });
+
+  // Block-local propagation
+  std::vector<TaskGraph::id_t> propagation(load.size());
+  for (int iC = 0; iC < load.size(); ++iC) {
+    propagation[iC] = graph.add([this,iC]() {
+      _block[iC]->stream();
+    });
+    graph.addDependency(propagation[iC], postCollide[iC]);
+  }
+
+  // Communicate (default) post processor neighborhood and apply them
+  addCommunication(getCommunicator(PostStream()), propagation, [this](int iC) {
+    _block[iC]->template postProcess<PostStream>();
+  });
+}
+
+template<typename T, typename DESCRIPTOR>
+void SuperLattice<T,DESCRIPTOR>::executeBlockTaskGraph()
+{
+  using namespace stage;
+
+  const std::array<std::size_t,2> revision{
+    getCommunicator(PostCollide()).getRevision(),
+    getCommunicator(PostStream()).getRevision()
+  };
+  if (!_blockTaskGraph || revision != _blockTaskGraphRevision) {
+    buildBlockTaskGraph();
+    _blockTaskGraphRevision = revision;
+  }
+
+#ifdef PARALLEL_MODE_MPI
+  singleton::mpi().beginProgress();
+  try {
+    _blockTaskGraph->execute(singleton::pool());
+  } catch (...) {
+    singleton::mpi().endProgress();
+    throw;
+  }
+  singleton::mpi().endProgress();
+#else
+  _blockTaskGraph->execute(singleton::pool());
+#endif
+}
+
+template<typename T, typename DESCRIPTOR>
+void SuperLattice<T,DESCRIPTOR>::setBlockExecutionStrategy(BlockExecutionStrategy strategy)
+{
+  if (strategy == BlockExecutionStrategy::TaskGraph) {
+#ifdef PARALLEL_MODE_MPI
+    // Communication is performed concurrently by the threads of the pool
+    if (singleton::mpi().getThreadLevel() < MPI_THREAD_MULTIPLE) {
+      throw std::logic_error("TaskGraph block execution requires MPI_THREAD_MULTIPLE");
+    }
+#endif
+    for (int iC = 0; iC < this->_loadBalancer.size(); ++iC) {
+      if (!isPlatformCPU(_block[iC]->getPlatform())) {
+        throw std::logic_error("TaskGraph block execution requires all blocks to use a CPU platform");
+      }
+    }
+  }
+  _blockExecutionStrategy = strategy;
+}
+
 template<typename T, typename DESCRIPTOR>
 template<typename STAGE>
 void SuperLattice<T,DESCRIPTOR>::executePostProcessors(STAGE stage)
@@ -703,6 +872,34 @@ void SuperLattice<T,DESCRIPTOR>::communicate()
   }
 }
 
+template<typename T, typename DESCRIPTOR>
+void SuperLattice<T,DESCRIPTOR>::filterPropagationCommunication()
+{
+  // Component-wise communication is implemented only by CPU block communicators
+  int nNonCPUBlocks = 0;
+  for (int iC = 0; iC < this->_loadBalancer.size(); ++iC) {
+    if (!isPlatformCPU(_block[iC]->getPlatform())) {
+      nNonCPUBlocks += 1;
+    }
+  }
+#ifdef PARALLEL_MODE_MPI
+  singleton::mpi().reduceAndBcast(nNonCPUBlocks, MPI_SUM);
+#endif
+  if (nNonCPUBlocks > 0) {
+    throw std::logic_error("Filtered propagation communication requires all blocks to use a CPU platform");
+  }
+
+  std::vector<LatticeR<DESCRIPTOR::d>> velocities;
+  for (int iPop=0; iPop < DESCRIPTOR::q; ++iPop) {
+    velocities.emplace_back(descriptors::c<DESCRIPTOR>(iPop));
+  }
+
+  auto& communicator = _communicator[typeid(stage::PostCollide)];
+  communicator = std::make_unique<SuperCommunicator<T,SuperLattice>>(*this);
+  communicator->template requestPropagation<descriptors::POPULATION>(velocities);
+  communicator->exchangeRequests();
+}
+
 template<typename T, typename DESCRIPTOR>
 void SuperLattice<T,DESCRIPTOR>::stripeOffDensityOffset(T offset)
 {
@@ -746,6 +943,25 @@ void SuperLattice<T,DESCRIPTOR>::addPostProcessor(PostProcessorPromise<T,DESCRIP
   }
 }
 
+template<typename T, typename DESCRIPTOR>
+template<typename PIPELINE>
+SuperStagePipeline<T,DESCRIPTOR>& SuperLattice<T,DESCRIPTOR>::getStagePipeline(PIPELINE pipeline)
+{
+  auto iter = _stagePipelines.find(typeid(PIPELINE));
+  if (iter == _stagePipelines.end()) {
+    iter = std::get<0>(_stagePipelines.emplace(typeid(PIPELINE),
+                                               std::make_unique<SuperStagePipeline<T,DESCRIPTOR>>(*this)));
+  }
+  return *std::get<1>(*iter);
+}
+
+template<typename T, typename DESCRIPTOR>
+template<typename PIPELINE>
+void SuperLattice<T,DESCRIPTOR>::executeStagePipeline(PIPELINE pipeline)
+{
+  getStagePipeline(pipeline).execute();
+}
+
 template<typename T, typename DESCRIPTOR>
 template<typename STAGE>
 void SuperLattice<T,DESCRIPTOR>::executeCustomTasks(STAGE stage)
@@ -0,0 +1,327 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef SUPER_LATTICE_AUTOTUNER_H
+#define SUPER_LATTICE_AUTOTUNER_H
+
+#include "superLattice.h"
+#include "blockLatticeSnapshot.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace olb {
+
+namespace autotuning {
+
+/// Collision configuration of a block that is selectable at runtime
+struct Configuration {
+  CollisionDispatchStrategy strategy;
+  CollisionLoopSchedule schedule;
+};
+
+inline std::string getName(CollisionDispatchStrategy strategy) {
+  switch (strategy) {
+  case CollisionDispatchStrategy::Dominant:
+    return "Dominant";
+  case CollisionDispatchStrategy::Individual:
+    return "Individual";
+  case CollisionDispatchStrategy::SkipTrivial:
+    return "SkipTrivial";
+  default:
+    throw std::invalid_argument("Invalid collision dispatch strategy");
+  }
+}
+
+inline std::string getName(CollisionLoopSchedule schedule) {
+  switch (schedule) {
+  case CollisionLoopSchedule::Dynamic:
+    return "Dynamic";
+  case CollisionLoopSchedule::Static:
+    return "Static";
+  default:
+    throw std::invalid_argument("Invalid collision loop schedule");
+  }
+}
+
+/// Returns model name of the host CPU as reported by /proc/cpuinfo
+inline std::string getHostCPUModel() {
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.starts_with("model name")) {
+      if (auto colon = line.find(':'); colon != std::string::npos) {
+        return line.substr(line.find_first_not_of(' ', colon+1));
+      }
+    }
+  }
+  return "unknown";
+}
+
+}
+
+/// Selects the fastest runtime collision configuration for each block of a SuperLattice
+/**
+ * Candidates are the CollisionDispatchStrategy and (for PARALLEL_MODE_OMP) the
+ * CollisionLoopSchedule of the dominant collision loop. Each candidate is
+ * micro-benchmarked on the actual block state which is restored afterwards.
+ *
+ * Decisions are cached in a plain text file keyed by host CPU model, platform,
+ * descriptor, dominant dynamics, its share of the block and number of threads.
+ * Later runs on the same host only apply the cached configurations.
+ *
+ * Platform, CSE-optimized dynamics and the cuboid decomposition are fixed at
+ * compile resp. setup time and can not be tuned this way. Opportunities are
+ * reported as hints instead.
+ *
+ * Only the block state is restored after benchmarking, i.e. tune() should be
+ * called prior to fusing couplings into the collision of the lattice.
+ *
+ * Usage:
+ *
+ *   SuperLatticeAutotuner autotuner(sLattice);
+ *   autotuner.tune(); // e.g. after initialization, prior to the first step
+ **/
+template <typename T, typename DESCRIPTOR>
+class SuperLatticeAutotuner {
+private:
+  SuperLattice<T,DESCRIPTOR>& _sLattice;
+  /// Path of the decision cache
+  const std::string _fileName;
+  /// Number of timed collisions per candidate
+  const unsigned _repetitions;
+  /// Cached configuration for each key
+  std::map<std::string,autotuning::Configuration> _cache;
+
+  mutable OstreamManager clout;
+
+  template <Platform PLATFORM>
+  std::vector<autotuning::Configuration> getCandidates() const
+  {
+    if constexpr (PLATFORM == Platform::CPU_SIMD) {
+      return {{CollisionDispatchStrategy::Dominant, CollisionLoopSchedule::Dynamic}};
+    } else {
+      return {
+        {CollisionDispatchStrategy::Dominant,    CollisionLoopSchedule::Dynamic},
+#ifdef PARALLEL_MODE_OMP
+        {CollisionDispatchStrategy::Dominant,    CollisionLoopSchedule::Static},
+#endif
+        // Uses a static schedule regardless of CollisionLoopSchedule
+        {CollisionDispatchStrategy::Individual,  CollisionLoopSchedule::Dynamic},
+        {CollisionDispatchStrategy::SkipTrivial, CollisionLoopSchedule::Dynamic},
+#ifdef PARALLEL_MODE_OMP
+        {CollisionDispatchStrategy::SkipTrivial, CollisionLoopSchedule::Static},
+#endif
+      };
+    }
+  }
+
+  /// Returns the most frequently assigned dynamics of block
+  template <Platform PLATFORM>
+  DynamicsPromise<T,DESCRIPTOR> getDominantDynamics(ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block) const
+  {
+    auto& dynamicsMap = block.getDynamicsMap();
+    const auto dynamics = dynamicsMap.getAll();
+    return *std::max_element(dynamics.begin(), dynamics.end(), [&](const auto& lhs, const auto& rhs) {
+      return dynamicsMap.getWeight(lhs) < dynamicsMap.getWeight(rhs);
+    });
+  }
+
+  template <Platform PLATFORM>
+  std::string getKey(ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block) const
+  {
+    const auto dominant = getDominantDynamics(block);
+    std::size_t nCore = 1;
+    for (unsigned iD=0; iD < DESCRIPTOR::d; ++iD) {
+      nCore *= block.getExtent()[iD];
+    }
+    // Share of cells using the dominant dynamics in steps of 10%
+    const int share = (10 * block.getDynamicsMap().getWeight(dominant)) / nCore;
+#ifdef PARALLEL_MODE_OMP
+    const int nThreads = singleton::omp().getSize();
+#else
+    const int nThreads = 1;
+#endif
+    std::stringstream key;
+    key << autotuning::getHostCPUModel()
+        << "; " << getName(PLATFORM)
+        << "; " << fields::name<DESCRIPTOR>()
+        << "; " << dominant.name()
+        << "; " << 10*share << "%"
+        << "; " << nThreads;
+    std::string result = key.str();
+    std::replace(result.begin(), result.end(), '\n', ' ');
+    return result;
+  }
+
+  /// Benchmarks all candidates on block and restores its state
+  template <Platform PLATFORM>
+  autotuning::Configuration tune(ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block) const
+  {
+    BlockLatticeSnapshot snapshot(block);
+    autotuning::Configuration fastest{};
+    double minTime = std::numeric_limits<double>::max();
+    for (auto candidate : getCandidates<PLATFORM>()) {
+      block.setCollisionDispatchStrategy(candidate.strategy);
+      block.setCollisionLoopSchedule(candidate.schedule);
+      const double time = measureMinimalRuntime([&]() {
+        block.collide();
+      }, _repetitions);
+      if (time < minTime) {
+        minTime = time;
+        fastest = candidate;
+      }
+    }
+    return fastest;
+  }
+
+  template <Platform PLATFORM>
+  void hint(ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block) const
+  {
+    const auto dominant = getDominantDynamics(block);
+    if (!dominant.hasOptimizedVersion() && dominant.isOptimizable().value_or(false)) {
+      clout << "Hint: No CSE-optimized version of dominant dynamics " << dominant.name()
+            << " is available, consider generating it" << std::endl;
+    }
+#ifdef PLATFORM_CPU_SIMD
+    if constexpr (PLATFORM == Platform::CPU_SISD) {
+      clout << "Hint: Block uses CPU_SISD although CPU_SIMD is enabled" << std::endl;
+    }
+#endif
+  }
+
+  /// Parses lines of "<strategy> <schedule> <key>" into entries
+  static void parse(std::istream& stream, std::map<std::string,autotuning::Configuration>& entries)
+  {
+    std::string line;
+    while (std::getline(stream, line)) {
+      std::istringstream entry(line);
+      std::string strategy, schedule, key;
+      if (entry >> strategy >> schedule && std::getline(entry >> std::ws, key)) {
+        entries[key] = {
+          strategy == "Individual"  ? CollisionDispatchStrategy::Individual  :
+          strategy == "SkipTrivial" ? CollisionDispatchStrategy::SkipTrivial : CollisionDispatchStrategy::Dominant,
+          schedule == "Static"      ? CollisionLoopSchedule::Static          : CollisionLoopSchedule::Dynamic
+        };
+      }
+    }
+  }
+
+  static std::string serialize(const std::map<std::string,autotuning::Configuration>& entries)
+  {
+    std::stringstream data;
+    for (const auto& [key, configuration] : entries) {
+      data << autotuning::getName(configuration.strategy) << " "
+           << autotuning::getName(configuration.schedule) << " "
+           << key << std::endl;
+    }
+    return data.str();
+  }
+
+  /// Merges newly tuned entries of all processes into the cache file
+  void writeCache(const std::map<std::string,autotuning::Configuration>& tuned)
+  {
+    std::string entries = serialize(tuned);
+#ifdef PARALLEL_MODE_MPI
+    for (int iRank=0; iRank < singleton::mpi().getSize(); ++iRank) {
+      std::string received = entries;
+      singleton::mpi().bCast(&received, 1, iRank);
+      std::istringstream stream(received);
+      parse(stream, _cache);
+    }
+#else
+    std::istringstream stream(entries);
+    parse(stream, _cache);
+#endif
+    if (singleton::mpi().isMainProcessor()) {
+      std::ofstream file(_fileName);
+      file << serialize(_cache);
+    }
+  }
+
+public:
+  SuperLatticeAutotuner(SuperLattice<T,DESCRIPTOR>& sLattice,
+                        std::string fileName = singleton::directories().getLogOutDir() + "autotuning.dat",
+                        unsigned repetitions = 5):
+    _sLattice(sLattice),
+    _fileName(fileName),
+    _repetitions(repetitions),
+    clout(std::cout, "SuperLatticeAutotuner")
+  { }
+
+  /// Apply cached configurations resp. benchmark uncached blocks
+  /**
+   * Must be called collectively by all processes.
+   **/
+  void tune()
+  {
+    _sLattice.communicate();
+    {
+      std::ifstream file(_fileName);
+      parse(file, _cache);
+    }
+
+    std::map<std::string,autotuning::Configuration> tuned;
+    std::size_t nTuned = 0;
+    auto& load = _sLattice.getLoadBalancer();
+    for (int iC = 0; iC < load.size(); ++iC) {
+      auto& block = _sLattice.getBlock(iC);
+      if (!isPlatformCPU(block.getPlatform())) {
+        continue;
+      }
+      callUsingConcretePlatform(block.getPlatform(), [&](auto platform) {
+        auto& concreteBlock = dynamic_cast<ConcreteBlockLattice<T,DESCRIPTOR,platform.value>&>(block);
+        const std::string key = getKey(concreteBlock);
+        autotuning::Configuration configuration;
+        if (auto cached = _cache.find(key); cached != _cache.end()) {
+          configuration = cached->second;
+        } else if (auto current = tuned.find(key); current != tuned.end()) {
+          configuration = current->second;
+        } else {
+          configuration = tune(concreteBlock);
+          tuned[key] = configuration;
+          nTuned += 1;
+          hint(concreteBlock);
+        }
+        concreteBlock.setCollisionDispatchStrategy(configuration.strategy);
+        concreteBlock.setCollisionLoopSchedule(configuration.schedule);
+        clout << "Block " << load.glob(iC) << ": "
+              << autotuning::getName(configuration.strategy) << " dispatch, "
+              << autotuning::getName(configuration.schedule) << " schedule" << std::endl;
+      });
+    }
+
+#ifdef PARALLEL_MODE_MPI
+    singleton::mpi().reduceAndBcast(nTuned, MPI_SUM);
+#endif
+    if (nTuned > 0) {
+      clout << "Benchmarked " << nTuned << " blocks, updating " << _fileName << std::endl;
+      writeCache(tuned);
+    }
+  }
+
+};
+
+}
+
+#endif
@@ -36,7 +36,8 @@ namespace olb {
 
 template <typename COUPLER, typename COUPLEES, Platform PLATFORM>
 class ConcreteBlockCouplingO<COUPLEES,PLATFORM,COUPLER,OperatorScope::PerCell>
-  final : public AbstractCouplingO<COUPLEES> {
+  final : public AbstractCouplingO<COUPLEES>
+        , public AbstractFusedCellO {
 private:
   template <typename VALUED_DESCRIPTOR>
   using ptr_to_lattice = ConcreteBlockLattice<typename VALUED_DESCRIPTOR::value_t,
@@ -52,15 +53,19 @@ private:
   std::unique_ptr<ConcreteBlockMask<typename COUPLEES::values_t::template get<0>::value_t,
                                     PLATFORM>> _mask;
 
-  void execute(typename AbstractCouplingO<COUPLEES>::LatticeR latticeR)
+  void execute(CellID iCell)
   {
-    CellID iCell = _lattices.template get<0>()->getCellId(latticeR);
     auto cells = _lattices.exchange_values([&](auto name) -> auto {
       return cpu::Cell{*_lattices.get(name), iCell};
     });
     COUPLER().apply(cells);
   }
 
+  void execute(typename AbstractCouplingO<COUPLEES>::LatticeR latticeR)
+  {
+    execute(_lattices.template get<0>()->getCellId(latticeR));
+  }
+
 public:
   template <typename LATTICES>
   ConcreteBlockCouplingO(LATTICES&& lattices):
@@ -86,6 +91,14 @@ public:
     _mask->set(iCell, state);
   }
 
+  /// Apply coupling to iCell if covered, used for fusion into a collision loop
+  void apply(CellID iCell) override
+  {
+    if (!_mask || _mask->operator[](iCell)) {
+      execute(iCell);
+    }
+  }
+
   void execute() override
   {
     using loc = typename AbstractCouplingO<COUPLEES>::LatticeR::value_t;
@@ -131,7 +144,8 @@ public:
 
 template <typename COUPLER, typename COUPLEES, Platform PLATFORM>
 class ConcreteBlockCouplingO<COUPLEES,PLATFORM,COUPLER,OperatorScope::PerCellWithParameters>
-  final : public AbstractCouplingO<COUPLEES> {
+  final : public AbstractCouplingO<COUPLEES>
+        , public AbstractFusedCellO {
 private:
   template <typename VALUED_DESCRIPTOR>
   using ptr_to_lattice = ConcreteBlockLattice<typename VALUED_DESCRIPTOR::value_t,
@@ -149,15 +163,19 @@ private:
   std::unique_ptr<ConcreteBlockMask<typename COUPLEES::values_t::template get<0>::value_t,
                                     PLATFORM>> _mask;
 
-  void execute(typename AbstractCouplingO<COUPLEES>::LatticeR latticeR)
+  void execute(CellID iCell)
   {
-    CellID iCell = _lattices.template get<0>()->getCellId(latticeR);
     auto cells = _lattices.exchange_values([&](auto name) -> auto {
       return cpu::Cell{*_lattices.get(name), iCell};
     });
     COUPLER().apply(cells, _parameters);
   }
 
+  void execute(typename AbstractCouplingO<COUPLEES>::LatticeR latticeR)
+  {
+    execute(_lattices.template get<0>()->getCellId(latticeR));
+  }
+
 public:
   template <typename LATTICES>
   ConcreteBlockCouplingO(LATTICES&& lattices):
@@ -183,6 +201,14 @@ public:
     _mask->set(iCell, state);
   }
 
+  /// Apply coupling to iCell if covered, used for fusion into a collision loop
+  void apply(CellID iCell) override
+  {
+    if (!_mask || _mask->operator[](iCell)) {
+      execute(iCell);
+    }
+  }
+
   void execute() override
   {
     using loc = typename AbstractCouplingO<COUPLEES>::LatticeR::value_t;
@@ -240,6 +266,8 @@ private:
   >> _lattices;
 
   std::vector<std::unique_ptr<AbstractCouplingO<COUPLEES>>> _block;
+  /// Removal of block couplings fused into collision steps (empty if not fused)
+  std::vector<std::function<void()>> _defuse;
 
   template <Platform PLATFORM>
   auto constructConcreteBlockCoupling(int iC)
@@ -280,7 +308,15 @@ public:
     }
   }
 
+  ~SuperLatticeCoupling()
+  {
+    defuse();
+  }
+
   /// Execute coupling operation on all blocks
+  /**
+   * Blocks whose coupling is fused into a collision step are skipped.
+   **/
   void execute()
   {
     auto& load = _lattices.template get<0>()->getLoadBalancer();
@@ -288,8 +324,58 @@ public:
     #pragma omp taskloop
     #endif
     for (int iC = 0; iC < load.size(); ++iC) {
-      _block[iC]->execute();
+      if (_defuse.empty() || !_defuse[iC]) {
+        _block[iC]->execute();
+      }
+    }
+  }
+
+  /// Fuse coupling into the collision step of the lattice called NAME
+  /**
+   * Applies the coupling to each cell immediately prior to its collision
+   * instead of in a separate pass over all coupled lattices. This is
+   * equivalent to calling execute() right before NAME's collideAndStream
+   * (e.g. directly after all other lattices were updated in the previous step).
+   *
+   * Only available for per-cell couplings, blocks on non-CPU platforms
+   * remain unfused and are still coupled by execute().
+   **/
+  template <typename NAME>
+  void fuseIntoCollision(NAME name = NAME{})
+  {
+    if constexpr (COUPLER::scope != OperatorScope::PerCell
+               && COUPLER::scope != OperatorScope::PerCellWithParameters) {
+      throw std::logic_error("Only per-cell couplings can be fused into collision");
+    }
+    defuse();
+    auto& load = _lattices.template get<0>()->getLoadBalancer();
+    _defuse.resize(load.size());
+    for (int iC = 0; iC < load.size(); ++iC) {
+      auto& block = _lattices.template get<NAME>()->getBlock(iC);
+      if (isPlatformCPU(block.getPlatform())) {
+        callUsingConcretePlatform(block.getPlatform(), [&](auto platform) {
+          using T = typename COUPLEES::template value<NAME>::value_t;
+          using DESCRIPTOR = typename COUPLEES::template value<NAME>::descriptor_t;
+          auto* concreteBlock = dynamic_cast<ConcreteBlockLattice<T,DESCRIPTOR,platform.value>*>(&block);
+          auto* op = dynamic_cast<AbstractFusedCellO*>(_block[iC].get());
+          concreteBlock->addFusedCollisionO(op);
+          _defuse[iC] = [concreteBlock,op]() {
+            concreteBlock->removeFusedCollisionO(op);
+          };
+        });
+      }
+    }
+  }
+
+  /// Revert fuseIntoCollision, coupling is then only applied by execute()
+  void defuse()
+  {
+    for (auto& f : _defuse) {
+      if (f) {
+        f();
+      }
     }
+    _defuse.clear();
   }
 
   /// Set coupling parameter FIELD
@@ -0,0 +1,96 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SUPER_LATTICE_ENSEMBLE_H
+#define SUPER_LATTICE_ENSEMBLE_H
+
+#include "superLattice.h"
+
+namespace olb {
+
+
+/// Ensemble of lattices sharing the geometry, executed as one batch
+/**
+ * Intended for parameter sweeps and uncertainty quantification where samples
+ * only differ in their parameters (e.g. inflow velocity or viscosity) but share
+ * geometry, dynamics and boundary structure.
+ *
+ * Each sample is a separate SuperLattice on the same SuperGeometry, i.e. the
+ * populations of different samples are not interleaved per cell. collideAndStream
+ * collides all samples before waiting for any of their post-collision communication,
+ * so its latency is only paid once per step instead of once per sample.
+ **/
+template <typename T, typename DESCRIPTOR>
+class SuperLatticeEnsemble {
+private:
+  std::vector<std::unique_ptr<SuperLattice<T,DESCRIPTOR>>> _lattices;
+
+public:
+  /// Construct nSamples lattices on sGeometry, throws for empty ensembles
+  SuperLatticeEnsemble(SuperGeometry<T,DESCRIPTOR::d>& sGeometry, std::size_t nSamples);
+
+  /// Number of samples
+  std::size_t size() const {
+    return _lattices.size();
+  }
+
+  /// Return lattice of sample iSample
+  SuperLattice<T,DESCRIPTOR>& get(std::size_t iSample) {
+    return *_lattices[iSample];
+  }
+  SuperLattice<T,DESCRIPTOR>& operator[](std::size_t iSample) {
+    return get(iSample);
+  }
+
+  /// Apply f(SuperLattice&, iSample) to the lattice of every sample
+  template <typename F>
+  void forEach(F&& f) {
+    for (std::size_t iSample = 0; iSample < size(); ++iSample) {
+      f(*_lattices[iSample], iSample);
+    }
+  }
+
+  /// Set per-sample values of PARAMETER
+  /**
+   * e.g. the viscosity dependent relaxation frequencies of
+   * all sampling points provided by UncertaintyQuantification
+   **/
+  template <typename PARAMETER>
+  void setParameter(const std::vector<FieldD<T,DESCRIPTOR,PARAMETER>>& values);
+
+  /// Initialize lattices of all samples
+  void initialize();
+
+  /// Perform one collideAndStream step for all samples
+  /**
+   * Equivalent to calling SuperLattice::collideAndStream for each sample
+   **/
+  void collideAndStream();
+
+};
+
+
+}
+
+#endif
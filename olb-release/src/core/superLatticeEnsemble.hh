@@ -0,0 +1,81 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SUPER_LATTICE_ENSEMBLE_HH
+#define SUPER_LATTICE_ENSEMBLE_HH
+
+#include "superLatticeEnsemble.h"
+
+namespace olb {
+
+
+template <typename T, typename DESCRIPTOR>
+SuperLatticeEnsemble<T,DESCRIPTOR>::SuperLatticeEnsemble(SuperGeometry<T,DESCRIPTOR::d>& sGeometry,
+                                                         std::size_t nSamples)
+{
+  if (nSamples == 0) {
+    throw std::invalid_argument("Ensemble must contain at least one sample");
+  }
+  _lattices.reserve(nSamples);
+  for (std::size_t iSample = 0; iSample < nSamples; ++iSample) {
+    _lattices.emplace_back(std::make_unique<SuperLattice<T,DESCRIPTOR>>(sGeometry));
+  }
+}
+
+template <typename T, typename DESCRIPTOR>
+template <typename PARAMETER>
+void SuperLatticeEnsemble<T,DESCRIPTOR>::setParameter(const std::vector<FieldD<T,DESCRIPTOR,PARAMETER>>& values)
+{
+  if (values.size() != size()) {
+    throw std::invalid_argument("Number of parameter values must match the number of samples");
+  }
+  for (std::size_t iSample = 0; iSample < size(); ++iSample) {
+    _lattices[iSample]->template setParameter<PARAMETER>(values[iSample]);
+  }
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeEnsemble<T,DESCRIPTOR>::initialize()
+{
+  for (auto& lattice : _lattices) {
+    lattice->initialize();
+  }
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeEnsemble<T,DESCRIPTOR>::collideAndStream()
+{
+  // Post-collision communication of all samples is in flight at the same time
+  for (auto& lattice : _lattices) {
+    lattice->beginCollideAndStream();
+  }
+  for (auto& lattice : _lattices) {
+    lattice->endCollideAndStream();
+  }
+}
+
+
+}
+
+#endif
@@ -120,7 +120,7 @@ public:
           typeid(stage::reduction::ReductionField),
           meta::id<BlockLatticeFieldReductionO<FIELD, REDUCTION_OP, CONDITION>> {});
     }
-    MPI_Comm_split(MPI_COMM_WORLD, _rankDoesReduction ? 0 : MPI_UNDEFINED, singleton::mpi().getRank(),
+    MPI_Comm_split(singleton::mpi().getCommunicator(), _rankDoesReduction ? 0 : MPI_UNDEFINED, singleton::mpi().getRank(),
                    &_mpiCommunicator);
 #endif
 
@@ -0,0 +1,458 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef SUPER_LATTICE_ROOFLINE_H
+#define SUPER_LATTICE_ROOFLINE_H
+
+#include "superLattice.h"
+#include "blockLatticeSnapshot.h"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+namespace olb {
+
+namespace roofline {
+
+/// Returns the STREAM triad bandwidth of this process in byte/s
+template <typename T>
+double measureBandwidth(std::size_t n, unsigned repetitions)
+{
+  std::unique_ptr<T[]> a(new T[n]);
+  std::unique_ptr<T[]> b(new T[n]);
+  std::unique_ptr<T[]> c(new T[n]);
+  // First touch by the threads that later access the data
+  #ifdef PARALLEL_MODE_OMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (std::size_t i=0; i < n; ++i) {
+    a[i] = T{0};
+    b[i] = T{1};
+    c[i] = T{2};
+  }
+  const T s = 3;
+  const double time = measureMinimalRuntime([&]() {
+    #ifdef PARALLEL_MODE_OMP
+    #pragma omp parallel for schedule(static)
+    #endif
+    for (std::size_t i=0; i < n; ++i) {
+      a[i] = b[i] + s*c[i];
+    }
+  }, repetitions);
+  volatile T sink = a[n/2];
+  (void) sink;
+  return 3 * n * sizeof(T) / time;
+}
+
+/// Returns the peak arithmetic performance of this process in FLOP/s
+/**
+ * Approximated by many independent fused multiply-add chains
+ **/
+template <typename T>
+double measurePeakPerformance(std::size_t n, unsigned repetitions)
+{
+  // Enough independent chains to hide the latency of vectorized FMAs
+  constexpr unsigned N = 64;
+  const double time = measureMinimalRuntime([&]() {
+    #ifdef PARALLEL_MODE_OMP
+    #pragma omp parallel
+    #endif
+    {
+      T acc[N];
+      for (unsigned i=0; i < N; ++i) {
+        acc[i] = T(i) / N;
+      }
+      for (std::size_t k=0; k < n; ++k) {
+        for (unsigned i=0; i < N; ++i) {
+#ifdef __FMA__
+          acc[i] = std::fma(acc[i], T{0.999999}, T{1e-6});
+#else
+          acc[i] = acc[i] * T{0.999999} + T{1e-6};
+#endif
+        }
+      }
+      T sum{};
+      for (unsigned i=0; i < N; ++i) {
+        sum += acc[i];
+      }
+      volatile T sink = sum;
+      (void) sink;
+    }
+  }, repetitions);
+#ifdef PARALLEL_MODE_OMP
+  const int nThreads = singleton::omp().getSize();
+#else
+  const int nThreads = 1;
+#endif
+  return 2. * N * n * nThreads / time;
+}
+
+/// Measured collision of cells using a single dynamics resp. of a block
+struct Measurement {
+  std::size_t cells = 0;
+  /// Runtime of a single collision step [s]
+  double time = 0;
+  /// Minimal memory traffic [byte]
+  double bytes = 0;
+  /// Arithmetic operations [FLOP], unknown without FEATURE_INSPECT_DYNAMICS
+  std::optional<double> flops;
+
+  Measurement& operator+=(const Measurement& rhs) {
+    cells += rhs.cells;
+    time  += rhs.time;
+    bytes += rhs.bytes;
+    if (flops && rhs.flops) {
+      *flops += *rhs.flops;
+    } else {
+      flops = std::nullopt;
+    }
+    return *this;
+  }
+};
+
+inline std::string escape(const std::string& in)
+{
+  std::string out;
+  for (char c : in) {
+    switch (c) {
+    case '"':
+      out += "\\\"";
+      break;
+    case '\\':
+      out += "\\\\";
+      break;
+    case '\n':
+      out += ' ';
+      break;
+    default:
+      out += c;
+    }
+  }
+  return out;
+}
+
+}
+
+/// Roofline performance report of the collision step of a SuperLattice
+/**
+ * The STREAM triad bandwidth and the peak FMA performance of each process are
+ * measured on construction. write() times the collision of each local CPU block
+ * as well as of the cells of each assigned dynamics separately (except for
+ * Platform::CPU_SIMD) on the actual (afterwards restored) block state.
+ *
+ * Memory traffic and arithmetic operations per cell are obtained from
+ * DynamicsPromise introspection. Both are only available if FEATURE_INSPECT_DYNAMICS
+ * is enabled. Otherwise the traffic is estimated as reading and writing all
+ * populations and the arithmetic performance is not reported.
+ *
+ * Roofline utilization is the ratio of the time bound max(bytes / bandwidth,
+ * FLOP / peak) to the measured time. Utilizations below 50% are classified
+ * as dispatch-limited, i.e. dominated by overhead instead of the roofline
+ * (only if the FLOP are known).
+ *
+ * All rates are per process as processes are measured concurrently.
+ *
+ * Usage:
+ *
+ *   SuperLatticeRoofline roofline(sLattice);
+ *   roofline.write(); // writes ./tmp/roofline.json
+ **/
+template <typename T, typename DESCRIPTOR>
+class SuperLatticeRoofline {
+private:
+  SuperLattice<T,DESCRIPTOR>& _sLattice;
+  /// Number of timed repetitions per measurement
+  const unsigned _repetitions;
+  /// STREAM triad bandwidth per process [byte/s]
+  double _bandwidth;
+  /// Peak arithmetic performance per process [FLOP/s]
+  double _peakPerformance;
+  /// Memory traffic and FLOP per cell for each dynamics
+  std::map<std::string, std::pair<double,std::optional<double>>> _costs;
+
+  mutable OstreamManager clout;
+
+  /// Returns memory traffic and FLOP of collision of a single cell using promised dynamics
+  std::pair<double,std::optional<double>> getCostPerCell(const DynamicsPromise<T,DESCRIPTOR>& promise)
+  {
+    auto iter = _costs.find(promise.name());
+    if (iter == _costs.end()) {
+      std::pair<double,std::optional<double>> cost;
+      if (promise.id() == typeid(NoDynamics<T,DESCRIPTOR>)) {
+        cost = {0, 0};
+      } else {
+        cost.first = promise.getMemoryBandwidth().value_or(2 * DESCRIPTOR::q * sizeof(T));
+        if (auto flops = promise.getArithmeticOperationCount()) {
+          cost.second = *flops;
+        }
+      }
+      iter = _costs.emplace(promise.name(), cost).first;
+    }
+    return iter->second;
+  }
+
+  /// Returns the roofline time bound of measurement
+  double getTimeBound(const roofline::Measurement& m) const
+  {
+    return std::max(m.bytes / _bandwidth, m.flops.value_or(0) / _peakPerformance);
+  }
+
+  /// Writes rates and classification of measurement into JSON object fields
+  void writeRates(std::ostream& out, const roofline::Measurement& m) const
+  {
+    const double utilization = m.time > 0 ? getTimeBound(m) / m.time : 0;
+    out << "\"cells\": " << m.cells
+        << ", \"time\": " << m.time
+        << ", \"bytes\": " << m.bytes
+        << ", \"bandwidth\": " << (m.time > 0 ? 1e-9 * m.bytes / m.time : 0);
+    if (m.flops) {
+      out << ", \"flops\": " << *m.flops
+          << ", \"performance\": " << (m.time > 0 ? 1e-9 * *m.flops / m.time : 0)
+          << ", \"arithmeticIntensity\": " << (m.bytes > 0 ? *m.flops / m.bytes : 0);
+    } else {
+      out << ", \"flops\": null, \"performance\": null, \"arithmeticIntensity\": null";
+    }
+    out << ", \"roofline\": " << 100 * utilization;
+    if (utilization < 0.5) {
+      // Compute-bound dynamics can only be excluded if the FLOP are known
+      out << ", \"limitedBy\": " << (m.flops ? "\"dispatch\"" : "null");
+    } else if (m.bytes / _bandwidth >= m.flops.value_or(0) / _peakPerformance) {
+      out << ", \"limitedBy\": \"bandwidth\"";
+    } else {
+      out << ", \"limitedBy\": \"compute\"";
+    }
+  }
+
+  /// Measures collision of block resp. of its dynamics
+  template <Platform PLATFORM>
+  roofline::Measurement measure(ConcreteBlockLattice<T,DESCRIPTOR,PLATFORM>& block,
+                                std::map<std::string,roofline::Measurement>& dynamicsMeasurements)
+  {
+    BlockLatticeSnapshot snapshot(block);
+    auto& dynamicsMap = block.getDynamicsMap();
+
+    roofline::Measurement blockMeasurement;
+    blockMeasurement.flops = 0;
+    for (const auto& promise : dynamicsMap.getAll()) {
+      roofline::Measurement m;
+      m.cells = dynamicsMap.getWeight(promise);
+      if (m.cells == 0) {
+        continue;
+      }
+      auto [bytes, flops] = getCostPerCell(promise);
+      m.bytes = m.cells * bytes;
+      if (flops) {
+        m.flops = m.cells * *flops;
+      }
+      if constexpr (PLATFORM != Platform::CPU_SIMD) {
+        m.time = measureMinimalRuntime([&]() {
+          dynamicsMap.collide(promise);
+        }, _repetitions);
+        auto [iter, _] = dynamicsMeasurements.try_emplace(promise.name(), roofline::Measurement{0, 0, 0, 0});
+        iter->second += m;
+      }
+      m.time = 0;
+      blockMeasurement += m;
+    }
+
+    blockMeasurement.time = measureMinimalRuntime([&]() {
+      block.collide();
+    }, _repetitions);
+    return blockMeasurement;
+  }
+
+#ifdef PARALLEL_MODE_MPI
+  /// Returns data of all processes on the main process
+  static std::vector<std::string> gather(std::string data)
+  {
+    std::vector<std::string> result;
+    if (singleton::mpi().isMainProcessor()) {
+      result.emplace_back(std::move(data));
+      for (int iRank=1; iRank < singleton::mpi().getSize(); ++iRank) {
+        int size{};
+        singleton::mpi().receive(&size, 1, iRank);
+        std::string received(size, ' ');
+        singleton::mpi().receive(received.data(), size, iRank);
+        result.emplace_back(std::move(received));
+      }
+    } else {
+      int size = data.size();
+      singleton::mpi().send(&size, 1, 0);
+      singleton::mpi().send(data.data(), size, 0);
+    }
+    return result;
+  }
+#else
+  static std::vector<std::string> gather(std::string data)
+  {
+    return {data};
+  }
+#endif
+
+public:
+  /// Measure bandwidth and peak performance baselines
+  /**
+   * \param streamSize Length of the STREAM triad arrays (should exceed the caches)
+   * \param fmaSteps   Iterations of the peak performance kernel
+   **/
+  SuperLatticeRoofline(SuperLattice<T,DESCRIPTOR>& sLattice,
+                       std::size_t streamSize = std::size_t{1} << 23,
+                       std::size_t fmaSteps = std::size_t{1} << 22,
+                       unsigned repetitions = 5):
+    _sLattice(sLattice),
+    _repetitions(repetitions),
+    clout(std::cout, "SuperLatticeRoofline")
+  {
+    singleton::mpi().barrier();
+    _bandwidth = roofline::measureBandwidth<T>(streamSize, _repetitions);
+    singleton::mpi().barrier();
+    _peakPerformance = roofline::measurePeakPerformance<T>(fmaSteps, _repetitions);
+#ifdef PARALLEL_MODE_MPI
+    singleton::mpi().reduceAndBcast(_bandwidth, MPI_SUM);
+    singleton::mpi().reduceAndBcast(_peakPerformance, MPI_SUM);
+    _bandwidth /= singleton::mpi().getSize();
+    _peakPerformance /= singleton::mpi().getSize();
+#endif
+    clout << "Bandwidth per process: " << 1e-9 * _bandwidth << " GB/s" << std::endl;
+    clout << "Peak performance per process: " << 1e-9 * _peakPerformance << " GFLOP/s" << std::endl;
+  }
+
+  /// Returns STREAM triad bandwidth per process [byte/s]
+  double getBandwidth() const {
+    return _bandwidth;
+  }
+  /// Returns peak arithmetic performance per process [FLOP/s]
+  double getPeakPerformance() const {
+    return _peakPerformance;
+  }
+
+  /// Measure collision performance and write report to fileName.json in the log directory
+  /**
+   * Must be called collectively by all processes.
+   **/
+  void write(std::string fileName = "roofline")
+  {
+    _sLattice.communicate();
+
+    std::map<std::string,roofline::Measurement> dynamicsMeasurements;
+    std::stringstream blocks;
+    blocks << std::setprecision(6);
+
+    auto& load = _sLattice.getLoadBalancer();
+    singleton::mpi().barrier();
+    for (int iC = 0; iC < load.size(); ++iC) {
+      auto& block = _sLattice.getBlock(iC);
+      if (!isPlatformCPU(block.getPlatform())) {
+        continue;
+      }
+      callUsingConcretePlatform(block.getPlatform(), [&](auto platform) {
+        auto& concreteBlock = dynamic_cast<ConcreteBlockLattice<T,DESCRIPTOR,platform.value>&>(block);
+        const roofline::Measurement m = measure(concreteBlock, dynamicsMeasurements);
+        blocks << "{\"globC\": " << load.glob(iC)
+               << ", \"rank\": " << singleton::mpi().getRank()
+               << ", \"platform\": \"" << getName(platform.value) << "\", ";
+        writeRates(blocks, m);
+        blocks << "}" << std::endl;
+      });
+    }
+
+    std::stringstream dynamics;
+    dynamics << std::setprecision(17);
+    for (const auto& [name, m] : dynamicsMeasurements) {
+      dynamics << m.cells << '\t' << m.time << '\t' << m.bytes << '\t'
+               << m.flops.value_or(-1) << '\t' << name << std::endl;
+    }
+
+    const auto allBlocks = gather(blocks.str());
+    const auto allDynamics = gather(dynamics.str());
+    if (!singleton::mpi().isMainProcessor()) {
+      return;
+    }
+
+    std::map<std::string,roofline::Measurement> aggregated;
+    for (const auto& data : allDynamics) {
+      std::istringstream stream(data);
+      std::string line;
+      while (std::getline(stream, line)) {
+        std::istringstream entry(line);
+        roofline::Measurement m;
+        double flops;
+        std::string name;
+        if (entry >> m.cells >> m.time >> m.bytes >> flops && std::getline(entry >> std::ws, name)) {
+          if (flops >= 0) {
+            m.flops = flops;
+          }
+          auto [iter, _] = aggregated.try_emplace(name, roofline::Measurement{0, 0, 0, 0});
+          iter->second += m;
+        }
+      }
+    }
+
+    std::ofstream out(singleton::directories().getLogOutDir() + fileName + ".json");
+    out << std::setprecision(6);
+    out << "{" << std::endl;
+    out << "  \"processes\": " << singleton::mpi().getSize() << "," << std::endl;
+#ifdef PARALLEL_MODE_OMP
+    out << "  \"threadsPerProcess\": " << singleton::omp().getSize() << "," << std::endl;
+#else
+    out << "  \"threadsPerProcess\": 1," << std::endl;
+#endif
+    out << "  \"descriptor\": \"" << roofline::escape(fields::name<DESCRIPTOR>()) << "\"," << std::endl;
+    out << "  \"baseline\": {\"bandwidth\": " << 1e-9 * _bandwidth
+        << ", \"performance\": " << 1e-9 * _peakPerformance
+        << ", \"ridgePoint\": " << _peakPerformance / _bandwidth << "}," << std::endl;
+
+    out << "  \"dynamics\": [";
+    bool first = true;
+    for (const auto& [name, m] : aggregated) {
+      out << (first ? "" : ",") << std::endl << "    {\"name\": \"" << roofline::escape(name) << "\", ";
+      writeRates(out, m);
+      out << "}";
+      first = false;
+      if (m.time > 0) {
+        clout << name << ": " << 1e-9 * m.bytes / m.time << " GB/s, "
+              << 100 * getTimeBound(m) / m.time << "% of roofline" << std::endl;
+      }
+    }
+    out << std::endl << "  ]," << std::endl;
+
+    out << "  \"blocks\": [";
+    first = true;
+    for (const auto& data : allBlocks) {
+      std::istringstream stream(data);
+      std::string line;
+      while (std::getline(stream, line)) {
+        out << (first ? "" : ",") << std::endl << "    " << line;
+        first = false;
+      }
+    }
+    out << std::endl << "  ]" << std::endl;
+    out << "}" << std::endl;
+  }
+
+};
+
+}
+
+#endif
@@ -0,0 +1,218 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef SUPER_STAGE_PIPELINE_H
+#define SUPER_STAGE_PIPELINE_H
+
+#include "communication/superCommunicator.h"
+#include "meta.h"
+
+#include <map>
+#include <set>
+#include <typeindex>
+
+namespace olb {
+
+template <typename T, typename DESCRIPTOR> class SuperLattice;
+
+/// Fused execution of consecutive post processor stages of a SuperLattice
+/**
+ * Each stage declares its footprint, i.e. the fields read by its operators
+ * in neighboring cells up to an overlap width and the fields written by them.
+ * Fields only accessed in the cell an operator is applied to need not be
+ * declared as reads.
+ *
+ * Upon the first execution the stages are grouped into sweeps:
+ *
+ * 1. A field read by a stage is exchanged iff it was written since its last
+ *    exchange (resp. the start of the pipeline) or only exchanged in a
+ *    narrower overlap.
+ * 2. If none of these fields is written by the stages of the current sweep,
+ *    their exchange is merged into the one preceding the sweep and the stage
+ *    is appended to it. Otherwise the stage starts a new sweep.
+ *
+ * Each sweep performs a single communication of the union of its fields
+ * followed by a single pass over all blocks applying its stages in order.
+ *
+ * Adding a stage also requests its footprint on the SuperLattice communicator
+ * of the stage, i.e. SuperLattice::executePostProcessors remains applicable.
+ *
+ * Usage:
+ *
+ *   auto& pipeline = sLattice.getStagePipeline(MyPipeline{});
+ *   pipeline.template add<StageA>(2, meta::list<EPSILON>{}, meta::list<MASS>{});
+ *   pipeline.template add<StageB>(1, meta::list<EPSILON>{}, meta::list<>{});
+ *   sLattice.executeStagePipeline(MyPipeline{}); // StageB is fused into StageA
+ **/
+template <typename T, typename DESCRIPTOR>
+class SuperStagePipeline {
+private:
+  using communicator_t = SuperCommunicator<T,SuperLattice<T,DESCRIPTOR>>;
+
+  struct Stage {
+    std::type_index id;
+    /// Overlap width of neighbor reads
+    int width;
+    std::vector<std::type_index> reads;
+    std::set<std::type_index> writes;
+  };
+
+  struct Sweep {
+    std::vector<std::type_index> stages;
+    /// Fields written by stages
+    std::set<std::type_index> writes;
+    /// Fields exchanged prior to the sweep
+    std::vector<std::type_index> fields;
+    int width = 0;
+    std::unique_ptr<communicator_t> communicator;
+  };
+
+  SuperLattice<T,DESCRIPTOR>& _sLattice;
+
+  std::vector<Stage> _stages;
+  /// Requests field on a communicator without concrete knowledge of the field
+  std::map<std::type_index,std::function<void(communicator_t&)>> _fieldRequests;
+
+  std::vector<Sweep> _sweeps;
+  /// False iff stages were added since the sweeps were determined
+  bool _compiled = false;
+
+  /// Determine sweeps and setup their communicators
+  /**
+   * Must be called collectively by all processes.
+   **/
+  void compile()
+  {
+    _sweeps.clear();
+    // Width up to which fields are valid in the overlap
+    std::map<std::type_index,int> exchanged;
+    for (const Stage& stage : _stages) {
+      std::vector<std::type_index> stale;
+      for (std::type_index field : stage.reads) {
+        auto iter = exchanged.find(field);
+        if (iter == exchanged.end() || iter->second < stage.width) {
+          stale.emplace_back(field);
+        }
+      }
+      const bool fusable = !_sweeps.empty() && std::none_of(stale.begin(), stale.end(), [&](auto field) {
+        return _sweeps.back().writes.contains(field);
+      });
+      if (!fusable) {
+        _sweeps.emplace_back();
+      }
+      Sweep& sweep = _sweeps.back();
+      for (std::type_index field : stale) {
+        if (std::find(sweep.fields.begin(), sweep.fields.end(), field) == sweep.fields.end()) {
+          sweep.fields.emplace_back(field);
+        }
+        sweep.width = std::max(sweep.width, stage.width);
+        exchanged[field] = std::max(exchanged[field], stage.width);
+      }
+      for (std::type_index field : stage.writes) {
+        exchanged.erase(field);
+        sweep.writes.emplace(field);
+      }
+      sweep.stages.emplace_back(stage.id);
+    }
+
+    for (Sweep& sweep : _sweeps) {
+      if (!sweep.fields.empty()) {
+        sweep.communicator = std::make_unique<communicator_t>(_sLattice);
+        sweep.communicator->requestOverlap(sweep.width);
+        for (std::type_index field : sweep.fields) {
+          _fieldRequests.at(field)(*sweep.communicator);
+        }
+        sweep.communicator->exchangeRequests();
+      }
+    }
+    _compiled = true;
+  }
+
+public:
+  SuperStagePipeline(SuperLattice<T,DESCRIPTOR>& sLattice):
+    _sLattice(sLattice)
+  { }
+
+  /// Append STAGE reading READS in neighbors up to width and writing WRITES
+  template <typename STAGE, typename... READS, typename... WRITES>
+  void add(int width, meta::list<READS...>, meta::list<WRITES...>)
+  {
+    Stage stage{typeid(STAGE), width, {typeid(READS)...}, {typeid(WRITES)...}};
+    (_fieldRequests.try_emplace(typeid(READS), [](communicator_t& communicator) {
+      communicator.template requestField<READS>();
+    }), ...);
+    _stages.emplace_back(stage);
+    _compiled = false;
+
+    if constexpr (sizeof...(READS) > 0) {
+      auto& communicator = _sLattice.getCommunicator(STAGE{});
+      communicator.requestOverlap(width);
+      (communicator.template requestField<READS>(), ...);
+      communicator.exchangeRequests();
+    }
+  }
+
+  /// Number of sweeps the stages are fused into
+  std::size_t getNsweeps()
+  {
+    if (!_compiled) {
+      compile();
+    }
+    return _sweeps.size();
+  }
+
+  /// Execute all stages in order
+  /**
+   * Must be called collectively by all processes.
+   **/
+  void execute()
+  {
+    if (!_compiled) {
+      compile();
+    }
+    auto& load = _sLattice.getLoadBalancer();
+    for (Sweep& sweep : _sweeps) {
+      #ifdef PLATFORM_GPU_CUDA
+      gpu::cuda::device::synchronize();
+      #endif
+
+      if (sweep.communicator) {
+        sweep.communicator->communicate();
+      }
+
+      #ifdef PARALLEL_MODE_OMP
+      #pragma omp taskloop
+      #endif
+      for (int iC = 0; iC < load.size(); ++iC) {
+        for (std::type_index stage : sweep.stages) {
+          _sLattice.getBlock(iC).postProcess(stage);
+        }
+      }
+    }
+  }
+
+};
+
+}
+
+#endif
@@ -0,0 +1,231 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef TASK_GRAPH_H
+#define TASK_GRAPH_H
+
+#include "threadPool.h"
+
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+
+namespace olb {
+
+/// Dependency graph of tasks executed by the work-stealing ThreadPool
+/**
+ * A task is scheduled as soon as all tasks it depends on are completed.
+ * Tasks without further dependencies are processed directly by the thread
+ * completing the last dependency in order to preserve cache locality.
+ *
+ * Polling tasks are re-tried until they report completion, e.g. to wait for
+ * non-blocking communication without blocking any thread of the pool.
+ *
+ * If any task throws, the remaining tasks are skipped and the first exception
+ * is rethrown by execute.
+ *
+ * Usage:
+ *
+ *   TaskGraph graph;
+ *   auto a = graph.add([]() { ... });
+ *   auto b = graph.add([]() { ... });
+ *   graph.addDependency(b, a); // b after a
+ *   graph.execute(singleton::pool());
+ **/
+class TaskGraph {
+public:
+  using id_t = std::size_t;
+
+private:
+  struct Node {
+    /// Returns false iff the task is to be re-tried later
+    std::function<bool()> task;
+    std::vector<id_t> successors;
+    std::size_t nDependencies = 0;
+    std::atomic<std::size_t> nPending{0};
+  };
+
+  /// Stable storage of nodes as their atomics are not movable
+  std::deque<Node> _nodes;
+  /// Number of tasks not yet completed during execution
+  std::atomic<std::size_t> _nRemaining{0};
+  /// True iff the dependencies were verified to be acyclic since the last change
+  bool _acyclic = false;
+
+  /// Set iff any task threw during execution
+  std::atomic<bool> _failed{false};
+  std::mutex _exceptionMutex;
+  std::exception_ptr _exception;
+
+  void run(ThreadPool& pool, id_t iNode)
+  {
+    while (true) {
+      Node& node = _nodes[iNode];
+      if (!_failed) {
+        try {
+          if (!node.task()) {
+            pool.defer([this,&pool,iNode]() {
+              run(pool, iNode);
+            });
+            return;
+          }
+        } catch (...) {
+          const std::scoped_lock lock(_exceptionMutex);
+          if (!_exception) {
+            _exception = std::current_exception();
+          }
+          _failed = true;
+        }
+      }
+      std::optional<id_t> next;
+      for (id_t iSuccessor : node.successors) {
+        if (--_nodes[iSuccessor].nPending == 0) {
+          if (next) {
+            pool.scheduleAndForget([this,&pool,iSuccessor]() {
+              run(pool, iSuccessor);
+            });
+          } else {
+            next = iSuccessor;
+          }
+        }
+      }
+      --_nRemaining;
+      if (next) {
+        iNode = *next;
+      } else {
+        return;
+      }
+    }
+  }
+
+  /// Throws if the dependencies contain a cycle, i.e. not all tasks could ever be scheduled
+  void checkAcyclic() const
+  {
+    std::vector<std::size_t> nPending(_nodes.size());
+    std::vector<id_t> ready;
+    for (id_t iNode=0; iNode < _nodes.size(); ++iNode) {
+      nPending[iNode] = _nodes[iNode].nDependencies;
+      if (nPending[iNode] == 0) {
+        ready.emplace_back(iNode);
+      }
+    }
+    std::size_t nVisited = 0;
+    while (!ready.empty()) {
+      const id_t iNode = ready.back();
+      ready.pop_back();
+      nVisited += 1;
+      for (id_t iSuccessor : _nodes[iNode].successors) {
+        if (--nPending[iSuccessor] == 0) {
+          ready.emplace_back(iSuccessor);
+        }
+      }
+    }
+    if (nVisited != _nodes.size()) {
+      throw std::logic_error("TaskGraph contains cyclic dependencies");
+    }
+  }
+
+public:
+  /// Adds task to the graph, returns its ID
+  id_t add(std::function<void()> task)
+  {
+    return addPolling([task=std::move(task)]() {
+      task();
+      return true;
+    });
+  }
+
+  /// Adds polling task to the graph, returns its ID
+  /**
+   * The task is re-scheduled behind all other available tasks for as long
+   * as it returns false, i.e. it must not block on the completion of others.
+   **/
+  id_t addPolling(std::function<bool()> task)
+  {
+    _nodes.emplace_back().task = std::move(task);
+    _acyclic = false;
+    return _nodes.size() - 1;
+  }
+
+  /// Declares that task may only start after dependency was completed
+  void addDependency(id_t task, id_t dependency)
+  {
+    _nodes.at(dependency).successors.emplace_back(task);
+    _nodes.at(task).nDependencies += 1;
+    _acyclic = false;
+  }
+
+  std::size_t size() const
+  {
+    return _nodes.size();
+  }
+
+  /// Removes all tasks
+  void clear()
+  {
+    _nodes.clear();
+    _acyclic = false;
+  }
+
+  /// Executes all tasks using pool, blocks until all of them are completed
+  /**
+   * The calling thread helps processing tasks. May be called repeatedly,
+   * the dependencies are only verified on the first call after any change.
+   * Throws prior to scheduling any task if the dependencies are cyclic.
+   * Rethrows the first exception thrown by any task after all tasks were
+   * completed resp. skipped.
+   **/
+  void execute(ThreadPool& pool)
+  {
+    if (!_acyclic) {
+      checkAcyclic();
+      _acyclic = true;
+    }
+    _failed = false;
+    _exception = nullptr;
+    for (auto& node : _nodes) {
+      node.nPending = node.nDependencies;
+    }
+    _nRemaining = _nodes.size();
+    for (id_t iNode=0; iNode < _nodes.size(); ++iNode) {
+      if (_nodes[iNode].nDependencies == 0) {
+        pool.scheduleAndForget([this,&pool,iNode]() {
+          run(pool, iNode);
+        });
+      }
+    }
+    pool.helpUntil([&]() {
+      return _nRemaining == 0;
+    });
+    if (_exception) {
+      std::rethrow_exception(_exception);
+    }
+  }
+
+};
+
+}
+
+#endif
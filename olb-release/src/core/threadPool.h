@@ -32,18 +32,14 @@
 #include <functional>
 #include <future>
 #include <vector>
+#include <memory>
+#include <cstdint>
 
 #include "core/olbDebug.h"
 #include "io/ostreamManager.h"
 
 namespace olb {
 
-/// Pool of threads for CPU-based background processing
-/**
- * Not intended for parallelization of performance critical paths but
- * for background processing of e.g. VTK output to reduce blocking of
- * simulation process.
- **/
 #ifdef FEATURE_EMSCRIPTEN
 class ThreadPool { // Dummy implementation for Emscripten
 public:
@@ -53,7 +49,11 @@ public:
 
   template <typename F>
   void scheduleAndForget(F&& f) {
-    throw std::runtime_error("ThreadPool::scheduleAndForget not implemented for Emscripten");
+    f();
+  }
+
+  template <typename F>
+  void defer(F&& f) {
     f();
   }
 
@@ -65,6 +65,14 @@ public:
 
   void wait() {}
 
+  /// Tasks are executed synchronously on scheduling, i.e. there is nothing to help with
+  template <typename PRED>
+  void helpUntil(PRED pred) {
+    if (!pred()) {
+      throw std::runtime_error("ThreadPool::helpUntil condition can not be reached by synchronous execution");
+    }
+  }
+
   template <typename T>
   void waitFor(std::vector<std::future<T>>& futures) {
     for (auto& future : futures) {
@@ -75,54 +83,254 @@ public:
 
 #else
 
-class ThreadPool {
+/// Lock-free work-stealing deque of pointers (Chase-Lev)
+/**
+ * Only the owning thread may push and pop at the bottom while any
+ * other thread may steal from the top.
+ *
+ * - Lê, N. M., Pop, A., Cohen, A., and Zappa Nardelli, F. Correct and
+ *   Efficient Work-Stealing for Weak Memory Models.
+ *   DOI: 10.1145/2442516.2442524
+ **/
+template <typename T>
+class WorkStealingDeque {
 private:
-  void work(unsigned iThread)
+  struct Array {
+    const std::int64_t capacity;
+    std::unique_ptr<std::atomic<T*>[]> data;
+
+    Array(std::int64_t c):
+      capacity(c),
+      data(new std::atomic<T*>[c]) { }
+
+    T* get(std::int64_t i) const {
+      return data[i & (capacity-1)].load(std::memory_order_relaxed);
+    }
+    void put(std::int64_t i, T* x) {
+      data[i & (capacity-1)].store(x, std::memory_order_relaxed);
+    }
+  };
+
+  alignas(64) std::atomic<std::int64_t> _top;
+  alignas(64) std::atomic<std::int64_t> _bottom;
+  std::atomic<Array*> _array;
+  /// Current and retired arrays, kept alive as long as thieves may access them
+  std::vector<std::unique_ptr<Array>> _arrays;
+
+  Array* grow(Array* a, std::int64_t bottom, std::int64_t top)
   {
-    while (_active) {
-      std::unique_lock lock(_mutex);
-      _available.wait(lock, [&]() {
-        return !_queue.empty()
-            || !_active;
-      });
-      if (_active) {
-        std::function<void()> task = std::move(_queue.front());
-        _queue.pop();
-        lock.unlock();
-        task();
-        --_taskCount;
-        if (_waiting) {
-          _done.notify_one();
+    auto& grown = _arrays.emplace_back(std::make_unique<Array>(2*a->capacity));
+    for (std::int64_t i=top; i < bottom; ++i) {
+      grown->put(i, a->get(i));
+    }
+    _array.store(grown.get(), std::memory_order_release);
+    return grown.get();
+  }
+
+public:
+  WorkStealingDeque(std::int64_t capacity = 1024):
+    _top{0},
+    _bottom{0}
+  {
+    OLB_PRECONDITION((capacity & (capacity-1)) == 0);
+    _arrays.emplace_back(std::make_unique<Array>(capacity));
+    _array.store(_arrays.back().get(), std::memory_order_relaxed);
+  }
+
+  /// Push x to the bottom, only to be called by the owner
+  void push(T* x)
+  {
+    std::int64_t b = _bottom.load(std::memory_order_relaxed);
+    std::int64_t t = _top.load(std::memory_order_acquire);
+    Array* a = _array.load(std::memory_order_relaxed);
+    if (b - t > a->capacity - 1) {
+      a = grow(a, b, t);
+    }
+    a->put(b, x);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(b + 1, std::memory_order_relaxed);
+  }
+
+  /// Pop from the bottom, only to be called by the owner
+  /**
+   * \returns nullptr if empty
+   **/
+  T* pop()
+  {
+    std::int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+    Array* a = _array.load(std::memory_order_relaxed);
+    _bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t t = _top.load(std::memory_order_relaxed);
+    T* x = nullptr;
+    if (t <= b) {
+      x = a->get(b);
+      if (t == b) {
+        // Last element, race against thieves
+        if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed)) {
+          x = nullptr;
         }
+        _bottom.store(b + 1, std::memory_order_relaxed);
       }
+    } else {
+      _bottom.store(b + 1, std::memory_order_relaxed);
     }
+    return x;
   }
 
-  mutable std::mutex _mutex;
+  /// Steal from the top, may be called by any thread
+  /**
+   * \returns nullptr if empty or if the race for the top element was lost
+   **/
+  T* steal()
+  {
+    std::int64_t t = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t b = _bottom.load(std::memory_order_acquire);
+    T* x = nullptr;
+    if (t < b) {
+      Array* a = _array.load(std::memory_order_acquire);
+      x = a->get(t);
+      if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                  std::memory_order_relaxed)) {
+        return nullptr;
+      }
+    }
+    return x;
+  }
 
-  std::atomic<bool> _waiting;
-  std::atomic<bool> _active;
+};
 
+/// Work-stealing pool of threads
+/**
+ * Each worker owns a lock-free deque of tasks. Tasks scheduled by a worker
+ * are pushed to its own deque and processed in LIFO order while idle workers
+ * steal in FIFO order. Tasks scheduled by other threads are injected via a
+ * shared queue. Threads waiting for completion help processing tasks.
+ *
+ * Used for background processing of e.g. VTK output to reduce blocking of
+ * the simulation process and for executing TaskGraph instances such as the
+ * block-local stages of SuperLattice::collideAndStream if it is configured
+ * to use BlockExecutionStrategy::TaskGraph.
+ **/
+class ThreadPool {
+private:
+  using task_t = std::function<void()>;
+
+  /// Pool and worker index of the current thread, if it is a worker
+  inline static thread_local ThreadPool* _currentPool = nullptr;
+  inline static thread_local unsigned _currentWorker = 0;
+
+  std::vector<std::unique_ptr<WorkStealingDeque<task_t>>> _deques;
+
+  /// Tasks scheduled by non-worker threads
+  std::mutex _injectionMutex;
+  std::queue<task_t*> _injected;
+  std::atomic<std::size_t> _injectedCount;
+
+  /// Number of scheduled but not yet started tasks
+  std::atomic<std::int64_t> _pending;
+  /// Number of scheduled but not yet completed tasks
   std::atomic<std::size_t> _taskCount;
 
+  /// Number of sleeping workers resp. helping threads
+  std::atomic<unsigned> _idle;
+  std::atomic<unsigned> _helping;
+
+  mutable std::mutex _mutex;
   std::condition_variable _available;
   std::condition_variable _done;
 
+  std::atomic<bool> _active;
+
   std::vector<std::thread> _threads;
-  std::queue<std::function<void()>> _queue;
 
   bool _initialized;
 
+  /// Returns next task to be processed by calling thread, nullptr if none was found
+  task_t* acquire()
+  {
+    task_t* task = nullptr;
+    unsigned iOffset = 0;
+    if (_currentPool == this) {
+      task = _deques[_currentWorker]->pop();
+      iOffset = _currentWorker + 1;
+    }
+    if (!task && _injectedCount > 0) {
+      const std::scoped_lock lock(_injectionMutex);
+      if (!_injected.empty()) {
+        task = _injected.front();
+        _injected.pop();
+        --_injectedCount;
+      }
+    }
+    for (unsigned i=0; !task && i < _deques.size(); ++i) {
+      task = _deques[(iOffset + i) % _deques.size()]->steal();
+    }
+    if (task) {
+      --_pending;
+    }
+    return task;
+  }
+
+  void process(task_t* task)
+  {
+    (*task)();
+    delete task;
+    --_taskCount;
+    if (_helping > 0) {
+      const std::scoped_lock lock(_mutex);
+      _done.notify_all();
+    }
+  }
+
+  void push(task_t* task, bool inject = false)
+  {
+    ++_taskCount;
+    ++_pending;
+    if (_currentPool == this && !inject) {
+      _deques[_currentWorker]->push(task);
+    } else {
+      const std::scoped_lock lock(_injectionMutex);
+      _injected.push(task);
+      ++_injectedCount;
+    }
+    if (_idle > 0 || _helping > 0) {
+      const std::scoped_lock lock(_mutex);
+      _available.notify_one();
+      _done.notify_all();
+    }
+  }
+
+  void work(unsigned iThread)
+  {
+    _currentPool = this;
+    _currentWorker = iThread;
+    while (_active) {
+      if (task_t* task = acquire()) {
+        process(task);
+      } else {
+        std::unique_lock lock(_mutex);
+        ++_idle;
+        _available.wait(lock, [&]() {
+          return _pending > 0
+              || !_active;
+        });
+        --_idle;
+      }
+    }
+  }
+
 public:
   ThreadPool():
-    _mutex{},
-    _waiting{false},
-    _active{true},
+    _injectedCount{0},
+    _pending{0},
     _taskCount{0},
-    _available{},
-    _done{},
+    _idle{0},
+    _helping{0},
+    _active{true},
     _threads{1},
-    _queue{},
     _initialized{false}
   { }
 
@@ -134,6 +342,9 @@ public:
     if (nThreads > 1) {
       _threads.resize(nThreads);
     }
+    for (unsigned iThread=0; iThread < _threads.size(); ++iThread) {
+      _deques.emplace_back(std::make_unique<WorkStealingDeque<task_t>>());
+    }
     for (unsigned iThread=0; iThread < _threads.size(); ++iThread) {
       _threads[iThread] = std::thread(&ThreadPool::work, this, iThread);
     }
@@ -145,10 +356,19 @@ public:
 
   ~ThreadPool()
   {
-    _active = false;
+    {
+      const std::scoped_lock lock(_mutex);
+      _active = false;
+    }
     _available.notify_all();
     for (std::thread& thread : _threads) {
-      thread.join();
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+    while (!_injected.empty()) {
+      delete _injected.front();
+      _injected.pop();
     }
   }
 
@@ -163,12 +383,20 @@ public:
   void scheduleAndForget(F&& f)
   {
     OLB_PRECONDITION(_initialized);
-    {
-      const std::scoped_lock lock(_mutex);
-      _queue.push(f);
-    }
-    ++_taskCount;
-    _available.notify_one();
+    push(new task_t(std::forward<F>(f)));
+  }
+
+  /// Schedule F behind all tasks already scheduled, tracking neither its return value nor completion
+  /**
+   * Unlike scheduleAndForget, F is always appended to the shared queue instead of
+   * the deque of the calling worker. Used to re-try polling tasks without starving
+   * the tasks scheduled before them.
+   **/
+  template <typename F>
+  void defer(F&& f)
+  {
+    OLB_PRECONDITION(_initialized);
+    push(new task_t(std::forward<F>(f)), true);
   }
 
   /// Schedule F and return future of its return value
@@ -176,28 +404,45 @@ public:
   std::future<R> schedule(F&& f)
   {
     OLB_PRECONDITION(_initialized);
-    auto packagedF = std::make_shared<std::packaged_task<R()>>(f);
-    {
-      const std::scoped_lock lock(_mutex);
-      _queue.push([packagedF]() {
-        (*packagedF)();
-      });
-    }
-    ++_taskCount;
-    _available.notify_one();
+    auto packagedF = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+    push(new task_t([packagedF]() {
+      (*packagedF)();
+    }));
     return packagedF->get_future();
   }
 
+  /// Processes tasks on the calling thread until pred() holds
+  /**
+   * Sleeps while no task is available for stealing.
+   **/
+  template <typename PRED>
+  void helpUntil(PRED pred)
+  {
+    OLB_PRECONDITION(_initialized);
+    ++_helping;
+    while (!pred()) {
+      if (task_t* task = acquire()) {
+        process(task);
+      } else {
+        std::unique_lock lock(_mutex);
+        _done.wait(lock, [&]() {
+          return pred()
+              || _pending > 0;
+        });
+      }
+    }
+    --_helping;
+  }
+
   /// Blocks until all tasks are completed
+  /**
+   * The calling thread helps processing the remaining tasks.
+   **/
   void wait()
   {
-    OLB_PRECONDITION(_initialized);
-    _waiting = true;
-    std::unique_lock lock(_mutex);
-    _done.wait(lock, [&]() {
+    helpUntil([&]() {
       return _taskCount == 0;
     });
-    _waiting = false;
   }
 
   /// Blocks until all tasks producing the given futures are completed
@@ -151,6 +151,21 @@ struct TYPED_FIELD_BASE : public FIELD_BASE<Cs...> {
   }
 };
 
+/// Base of a field that is only set on a small subset of cells (e.g. boundaries)
+/**
+ * Rows are stored compactly, unset rows read as the initial value of the field.
+ * GPU targets fall back to dense storage.
+ **/
+template <unsigned... Cs>
+struct SPARSE_FIELD_BASE : public FIELD_BASE<Cs...> {
+  template <typename T>
+#ifdef PLATFORM_GPU_CUDA
+  using column_type = AbstractColumn<T>;
+#else
+  using column_type = AbstractSparseColumn<T>;
+#endif
+};
+
 /// Base of a field of scalar TYPE<BASE_TYPE> with dimensions same as FIELD_BASE
 template <template<typename> typename TYPE, unsigned... Cs>
 struct TEMPLATE_FIELD_BASE : public FIELD_BASE<Cs...> {
@@ -50,6 +50,7 @@
 #include "porousPowerLawBGKdynamics.h"
 #include "shanChenDynOmegaForcedPostProcessor2D.h"
 #include "shanChenForcedPostProcessor.h"
+#include "runningStatistics.h"
 #include "shanChenForcedSingleComponentPostProcessor2D.h"
 #include "smagorinskyBGKdynamics.h"
 #include "smagorinskyMRTdynamics.h"
@@ -48,6 +48,7 @@
 //#include "rtlbmDynamics.h"
 #include "shanChenDynOmegaForcedPostProcessor3D.h"
 #include "shanChenForcedPostProcessor.h"
+#include "runningStatistics.h"
 #include "shanChenForcedSingleComponentPostProcessor3D.h"
 #include "smagorinskyBGKdynamics.h"
 #include "smagorinskyMRTdynamics.h"
@@ -41,6 +41,9 @@ struct Stage3 {};
 struct Stage4 {};
 struct Stage5 {};
 
+/// Fused sequence of Stage0 to Stage5 (c.f. SuperStagePipeline)
+struct Pipeline {};
+
 template<typename T>
 constexpr T zeroThreshold() {
   if constexpr (std::is_same<T, float>::value) {
@@ -0,0 +1,245 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef FREE_SURFACE_INTERFACE_BAND_H
+#define FREE_SURFACE_INTERFACE_BAND_H
+
+#include "dynamics/freeSurfaceHelpers.h"
+#include "core/blockLattice.h"
+
+namespace olb {
+
+namespace FreeSurface {
+
+/// Active core cells of the free surface post processors of a block
+/**
+ * All free surface stages only modify interface cells and their direct
+ * neighbors. The band contains all core cells that are an interface cell,
+ * have an interface neighbor or still carry CELL_FLAGS of the previous step.
+ *
+ * The band is not serialized and rebuilt by a full sweep once invalidated.
+ **/
+class InterfaceBandD final : public Serializable {
+private:
+  /// Sorted IDs of active core cells
+  std::vector<CellID> _cells;
+  /// Core cells adjacent to the overlap, candidates for interfaces created by neighbors
+  std::vector<CellID> _boundary;
+  /// Per-cell state used to collect candidates without sorting
+  std::vector<std::uint8_t> _state;
+  bool _valid;
+
+public:
+  static constexpr std::uint8_t core      = 1;
+  static constexpr std::uint8_t candidate = 2;
+
+  InterfaceBandD(std::size_t size):
+    _state(size, 0),
+    _valid(false)
+  { }
+
+  InterfaceBandD& asAbstract() {
+    return *this;
+  }
+
+  const std::vector<CellID>& getCells() const {
+    return _cells;
+  }
+
+  bool isValid() const {
+    return _valid;
+  }
+  /// Trigger rebuild by full sweep e.g. after external changes of CELL_TYPE
+  void invalidate() {
+    _valid = false;
+  }
+
+  template <typename BLOCK>
+  void setup(BLOCK& block);
+  template <typename BLOCK>
+  void update(BLOCK& block);
+
+  void setProcessingContext(ProcessingContext) { }
+
+  std::size_t getNblock() const override {
+    return 0;
+  }
+  std::size_t getSerializableSize() const override {
+    return 0;
+  }
+  bool* getBlock(std::size_t iBlock, std::size_t& sizeBlock, bool loadingMode) override {
+    return nullptr;
+  }
+
+};
+
+/// Describe InterfaceBandD in Data
+struct InterfaceBand {
+  template <typename T, typename DESCRIPTOR, Platform PLATFORM>
+  using type = InterfaceBandD;
+};
+
+template <typename BLOCK>
+void InterfaceBandD::setup(BLOCK& block)
+{
+  if (!_boundary.empty()) {
+    return;
+  }
+  constexpr unsigned D = BLOCK::descriptor_t::d;
+  const auto extent = block.getExtent();
+  block.forCoreSpatialLocations([&](LatticeR<D> loc) {
+    const CellID iCell = block.getCellId(loc);
+    _state[iCell] = core;
+    for (unsigned iD=0; iD < D; ++iD) {
+      if (loc[iD] == 0 || loc[iD] == extent[iD]-1) {
+        _boundary.emplace_back(iCell);
+        break;
+      }
+    }
+  });
+}
+
+template <typename BLOCK>
+void InterfaceBandD::update(BLOCK& block)
+{
+  using DESCRIPTOR = typename BLOCK::descriptor_t;
+  cpu::Cell<typename BLOCK::value_t,DESCRIPTOR,BLOCK::platform> cell(block, 0);
+  auto isActive = [&](CellID iCell) -> bool {
+    cell.setCellId(iCell);
+    return isCellType(cell, Type::Interface)
+        || hasNeighbour(cell, Type::Interface)
+        || cell.template getField<CELL_FLAGS>() != Flags::None;
+  };
+
+  std::vector<CellID> cells;
+  if (!_valid) {
+    for (CellID iCell=0; iCell < _state.size(); ++iCell) {
+      if ((_state[iCell] & core) && isActive(iCell)) {
+        cells.emplace_back(iCell);
+      }
+    }
+    _valid = true;
+  } else {
+    // Cells only enter the band next to a previous band cell or the overlap
+    std::vector<CellID> candidates;
+    auto mark = [&](CellID iCell) {
+      if ((_state[iCell] & (core | candidate)) == core) {
+        _state[iCell] |= candidate;
+        candidates.emplace_back(iCell);
+      }
+    };
+    for (CellID iCell : _cells) {
+      mark(iCell);
+      for (int iPop=1; iPop < DESCRIPTOR::q; ++iPop) {
+        mark(iCell + block.getNeighborDistance(descriptors::c<DESCRIPTOR>(iPop)));
+      }
+    }
+    for (CellID iCell : _boundary) {
+      mark(iCell);
+    }
+    for (CellID iCell : candidates) {
+      _state[iCell] &= ~candidate;
+      if (isActive(iCell)) {
+        cells.emplace_back(iCell);
+      }
+    }
+    std::sort(cells.begin(), cells.end());
+  }
+  _cells = std::move(cells);
+}
+
+/// Maintains the InterfaceBand of a block, to be executed prior to all other stages
+struct UpdateInterfaceBandO {
+  static constexpr OperatorScope scope = OperatorScope::PerBlock;
+
+  int getPriority() const {
+    return 0;
+  }
+
+  template <typename BLOCK>
+  void setup(BLOCK& block) {
+    if constexpr (isPlatformCPU(BLOCK::platform)) {
+      block.template getData<InterfaceBand>().setup(block);
+    }
+  }
+
+  template <typename BLOCK>
+  void apply(BLOCK& block) {
+    if constexpr (isPlatformCPU(BLOCK::platform)) {
+      block.template getData<InterfaceBand>().update(block);
+    } else {
+      throw std::runtime_error("InterfaceBand is only supported on CPU platforms");
+    }
+  }
+};
+
+/// Applies the cell-wise free surface OPERATOR to the InterfaceBand of a block
+template <typename OPERATOR>
+struct InterfaceBandO {
+  static constexpr OperatorScope scope = OperatorScope::PerBlock;
+
+  int getPriority() const {
+    return OPERATOR().getPriority();
+  }
+
+  template <typename BLOCK>
+  void setup(BLOCK& block) {
+    if constexpr (OPERATOR::scope == OperatorScope::PerCellWithParameters) {
+      block.template getData<OperatorParameters<OPERATOR>>();
+    }
+  }
+
+  template <typename BLOCK>
+  void apply(BLOCK& block) {
+    if constexpr (isPlatformCPU(BLOCK::platform)) {
+      const auto& cells = block.template getData<InterfaceBand>().getCells();
+      cpu::Cell<typename BLOCK::value_t,typename BLOCK::descriptor_t,BLOCK::platform> cell(block, 0);
+      if constexpr (OPERATOR::scope == OperatorScope::PerCellWithParameters) {
+        auto& parameters = block.template getData<OperatorParameters<OPERATOR>>().parameters;
+        #ifdef PARALLEL_MODE_OMP
+        #pragma omp parallel for schedule(static) firstprivate(cell)
+        #endif
+        for (CellID iCell : cells) {
+          cell.setCellId(iCell);
+          OPERATOR().apply(cell, parameters);
+        }
+      } else {
+        #ifdef PARALLEL_MODE_OMP
+        #pragma omp parallel for schedule(static) firstprivate(cell)
+        #endif
+        for (CellID iCell : cells) {
+          cell.setCellId(iCell);
+          OPERATOR().apply(cell);
+        }
+      }
+    } else {
+      throw std::runtime_error("InterfaceBand is only supported on CPU platforms");
+    }
+  }
+};
+
+}
+
+}
+
+#endif
@@ -26,6 +26,7 @@
 #define FREE_SURFACE_POST_PROCESSOR_2D_H
 
 #include "dynamics/freeSurfaceHelpers.h"
+#include "dynamics/freeSurfaceInterfaceBand.h"
 #include "core/postProcessing.h"
 #include "core/blockLattice.h"
 #include "core/superLattice.h"
@@ -170,7 +171,15 @@ private:
 public:
   FreeSurface2DSetup(SuperLattice<T, DESCRIPTOR>& sLattice);
 
+  /// Schedules all stages, restricted to the FreeSurface::InterfaceBand on CPU blocks
   void addPostProcessor();
+
+  /// Rebuilds the interface band by a full sweep prior to the next step
+  /**
+   * Required after changing CELL_TYPE or CELL_FLAGS outside of the free surface
+   * stages once the simulation was started, e.g. after loading a checkpoint.
+   **/
+  void invalidateInterfaceBand();
 };
 
 }
@@ -536,82 +536,77 @@ FreeSurface3DSetup<T,DESCRIPTOR>::FreeSurface3DSetup(SuperLattice<T, DESCRIPTOR>
 
 template<typename T, typename DESCRIPTOR>
 void FreeSurface3DSetup<T,DESCRIPTOR>::addPostProcessor() {
-  _sLattice.template addPostProcessor<FreeSurface::Stage0>(
-    meta::id<FreeSurfaceMassFlowPostProcessor3D<T,DESCRIPTOR>>{});
-  _sLattice.template addPostProcessor<FreeSurface::Stage1>(
-    meta::id<FreeSurfaceInterfaceReconstructionPostProcessor3D<T,DESCRIPTOR>>{});
-  _sLattice.template addPostProcessor<FreeSurface::Stage2>(
-    meta::id<FreeSurfaceToFluidCellConversionPostProcessor3D<T,DESCRIPTOR>>{});
-  _sLattice.template addPostProcessor<FreeSurface::Stage3>(
-    meta::id<FreeSurfaceToGasCellConversionPostProcessor3D<T,DESCRIPTOR>>{});
-  _sLattice.template addPostProcessor<FreeSurface::Stage4>(
-    meta::id<FreeSurfaceMassExcessPostProcessor3D<T,DESCRIPTOR>>{});
-  _sLattice.template addPostProcessor<FreeSurface::Stage5>(
-    meta::id<FreeSurfaceFinalizeConversionPostProcessor3D<T,DESCRIPTOR>>{});
-
-  {
-    // Communicate fields: EPSILON, CELL_TYPE, POPULATION, and PREVIOUS_VELOCITY
-    auto& communicator = _sLattice.getCommunicator(FreeSurface::Stage0());
-    communicator.requestOverlap(_sLattice.getOverlap());
-    communicator.template requestField<FreeSurface::EPSILON>();
-    communicator.template requestField<FreeSurface::CELL_TYPE>();
-    communicator.template requestField<descriptors::POPULATION>();
-    communicator.template requestField<FreeSurface::PREVIOUS_VELOCITY>();
-    communicator.exchangeRequests();
-  }
-
-  {
-    // Communicate fields: MASS and PREVIOUS_VELOCITY
-    auto& communicator = _sLattice.getCommunicator(FreeSurface::Stage1());
-    communicator.requestOverlap(_sLattice.getOverlap());
-    communicator.template requestField<FreeSurface::MASS>();
-    communicator.template requestField<FreeSurface::PREVIOUS_VELOCITY>();
-    communicator.exchangeRequests();
-  }
-
-  {
-    // Communicate fields: CELL_FLAGS and POPULATION
-    auto& communicator = _sLattice.getCommunicator(FreeSurface::Stage2());
-    communicator.requestOverlap(_sLattice.getOverlap());
-    communicator.template requestField<FreeSurface::CELL_FLAGS>();
-    communicator.template requestField<descriptors::POPULATION>();
-    communicator.exchangeRequests();
-  }
-
-  {
-    // Communicate fields: CELL_FLAGS
-    auto& communicator = _sLattice.getCommunicator(FreeSurface::Stage3());
-    communicator.requestOverlap(_sLattice.getOverlap());
-    communicator.template requestField<FreeSurface::CELL_FLAGS>();
-    communicator.exchangeRequests();
-  }
-
-  {
-    // Communicate fields: CELL_FLAGS
-    auto& communicator = _sLattice.getCommunicator(FreeSurface::Stage4());
-    communicator.requestOverlap(_sLattice.getOverlap());
-    communicator.template requestField<FreeSurface::CELL_FLAGS>();
-    communicator.exchangeRequests();
-  }
-
-  {
-    // Communicate fields: TEMP_MASS_EXCHANGE
-    auto& communicator = _sLattice.getCommunicator(FreeSurface::Stage5());
-    communicator.requestOverlap(_sLattice.getOverlap());
-    communicator.template requestField<FreeSurface::TEMP_MASS_EXCHANGE>();
-    communicator.exchangeRequests();
-  }
+  auto& load = _sLattice.getLoadBalancer();
+  for (int iC = 0; iC < load.size(); ++iC) {
+    auto& block = _sLattice.getBlock(iC);
+    const bool restrictToBand = isPlatformCPU(block.getPlatform());
+    // All stages only act on interface cells and their neighbours, i.e. CPU blocks
+    // skip the bulk by applying them to the band maintained prior to Stage0
+    auto add = [&](std::type_index stage, auto id) {
+      using OPERATOR = typename decltype(id)::type;
+      if (restrictToBand) {
+        block.addPostProcessor(stage, meta::id<FreeSurface::InterfaceBandO<OPERATOR>>{});
+      } else {
+        block.addPostProcessor(stage, id);
+      }
+    };
+    if (restrictToBand) {
+      block.addPostProcessor(typeid(FreeSurface::Stage0),
+                             meta::id<FreeSurface::UpdateInterfaceBandO>{});
+    }
+    add(typeid(FreeSurface::Stage0), meta::id<FreeSurfaceMassFlowPostProcessor3D<T,DESCRIPTOR>>{});
+    add(typeid(FreeSurface::Stage1), meta::id<FreeSurfaceInterfaceReconstructionPostProcessor3D<T,DESCRIPTOR>>{});
+    add(typeid(FreeSurface::Stage2), meta::id<FreeSurfaceToFluidCellConversionPostProcessor3D<T,DESCRIPTOR>>{});
+    add(typeid(FreeSurface::Stage3), meta::id<FreeSurfaceToGasCellConversionPostProcessor3D<T,DESCRIPTOR>>{});
+    add(typeid(FreeSurface::Stage4), meta::id<FreeSurfaceMassExcessPostProcessor3D<T,DESCRIPTOR>>{});
+    add(typeid(FreeSurface::Stage5), meta::id<FreeSurfaceFinalizeConversionPostProcessor3D<T,DESCRIPTOR>>{});
+  }
+
+  // Declare fields read in neighbouring cells resp. written by each stage. Stage1
+  // is fused into Stage0 as it only reads fields exchanged prior to Stage0 that
+  // are not modified by the latter. Stages 2 to 5 only access direct neighbours.
+  using namespace FreeSurface;
+  auto& pipeline = _sLattice.getStagePipeline(FreeSurface::Pipeline{});
+  pipeline.template add<Stage0>(_sLattice.getOverlap(),
+    meta::list<CELL_TYPE, EPSILON, descriptors::POPULATION>{},
+    meta::list<CELL_FLAGS, TEMP_MASS_EXCHANGE, MASS>{});
+  pipeline.template add<Stage1>(_sLattice.getOverlap(),
+    meta::list<CELL_TYPE, EPSILON, descriptors::POPULATION>{},
+    meta::list<CELL_FLAGS, descriptors::POPULATION>{});
+  pipeline.template add<Stage2>(1,
+    meta::list<CELL_TYPE, CELL_FLAGS, descriptors::POPULATION>{},
+    meta::list<CELL_FLAGS, descriptors::POPULATION>{});
+  pipeline.template add<Stage3>(1,
+    meta::list<CELL_FLAGS>{},
+    meta::list<CELL_FLAGS, MASS>{});
+  pipeline.template add<Stage4>(1,
+    meta::list<CELL_TYPE, CELL_FLAGS, EPSILON>{},
+    meta::list<MASS, TEMP_MASS_EXCHANGE>{});
+  pipeline.template add<Stage5>(1,
+    meta::list<CELL_FLAGS, TEMP_MASS_EXCHANGE>{},
+    meta::list<CELL_TYPE, EPSILON, MASS, PREVIOUS_VELOCITY>{});
 
   // Add custom tasks to be executed post stream
   _sLattice.template addCustomTask<stage::PostStream>([&]() {
-    _sLattice.executePostProcessors(FreeSurface::Stage0());
-    _sLattice.executePostProcessors(FreeSurface::Stage1());
-    _sLattice.executePostProcessors(FreeSurface::Stage2());
-    _sLattice.executePostProcessors(FreeSurface::Stage3());
-    _sLattice.executePostProcessors(FreeSurface::Stage4());
-    _sLattice.executePostProcessors(FreeSurface::Stage5());
+    _sLattice.executeStagePipeline(FreeSurface::Pipeline{});
   });
 }
 
+template<typename T, typename DESCRIPTOR>
+void FreeSurface3DSetup<T,DESCRIPTOR>::invalidateInterfaceBand() {
+  auto& load = _sLattice.getLoadBalancer();
+  for (int iC = 0; iC < load.size(); ++iC) {
+    auto& block = _sLattice.getBlock(iC);
+    if (isPlatformCPU(block.getPlatform())) {
+      callUsingConcretePlatform(block.getPlatform(), [&](auto platform) {
+        if constexpr (isPlatformCPU(platform.value)) {
+          auto& concreteBlock = dynamic_cast<ConcreteBlockLattice<T,DESCRIPTOR,platform.value>&>(block);
+          concreteBlock.template getData<FreeSurface::InterfaceBand>().invalidate();
+        }
+      });
+    }
+  }
+}
+
 }
 #endif
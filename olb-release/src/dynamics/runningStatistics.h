@@ -0,0 +1,202 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef DYNAMICS_RUNNING_STATISTICS_H
+#define DYNAMICS_RUNNING_STATISTICS_H
+
+#include <limits>
+
+#include "core/operator.h"
+#include "descriptor/fields.h"
+
+namespace olb {
+
+namespace statistics {
+
+/// Lattice density
+struct Density {
+  template <typename DESCRIPTOR>
+  static constexpr unsigned size() {
+    return 1;
+  }
+
+  template <typename V, typename DESCRIPTOR>
+  static Vector<V,1> compute(V rho, const Vector<V,DESCRIPTOR::d>& u) any_platform {
+    return Vector<V,1>(rho);
+  }
+};
+
+/// Lattice pressure w.r.t. the reference density
+/**
+ * Scale by UnitConverter::getConversionFactorPressure for physical values.
+ **/
+struct Pressure {
+  template <typename DESCRIPTOR>
+  static constexpr unsigned size() {
+    return 1;
+  }
+
+  template <typename V, typename DESCRIPTOR>
+  static Vector<V,1> compute(V rho, const Vector<V,DESCRIPTOR::d>& u) any_platform {
+    return Vector<V,1>((rho - V{1}) / descriptors::invCs2<V,DESCRIPTOR>());
+  }
+};
+
+/// Lattice velocity, its co-moments yield the Reynolds stresses
+struct Velocity {
+  template <typename DESCRIPTOR>
+  static constexpr unsigned size() {
+    return DESCRIPTOR::d;
+  }
+
+  template <typename V, typename DESCRIPTOR>
+  static Vector<V,DESCRIPTOR::d> compute(V rho, const Vector<V,DESCRIPTOR::d>& u) any_platform {
+    return u;
+  }
+};
+
+/// Number of samples accumulated by RunningStatisticsO
+struct SAMPLES : public descriptors::FIELD_BASE<1> { };
+
+/// Running mean of QUANTITY
+template <typename QUANTITY>
+struct MEAN : public descriptors::FIELD_BASE_CUSTOM_SIZE {
+  template <typename DESCRIPTOR>
+  static constexpr unsigned size() {
+    return QUANTITY::template size<DESCRIPTOR>();
+  }
+
+  template <typename T, typename DESCRIPTOR>
+  static constexpr auto getInitialValue() {
+    return Vector<value_type<T>, size<DESCRIPTOR>()>{};
+  }
+};
+
+/// Sum of products of deviations from the mean of QUANTITY (symmetric, ordered as util::TensorVal)
+template <typename QUANTITY>
+struct M2 : public descriptors::FIELD_BASE_CUSTOM_SIZE {
+  template <typename DESCRIPTOR>
+  static constexpr unsigned size() {
+    constexpr unsigned n = QUANTITY::template size<DESCRIPTOR>();
+    return (n * (n+1)) / 2;
+  }
+
+  template <typename T, typename DESCRIPTOR>
+  static constexpr auto getInitialValue() {
+    return Vector<value_type<T>, size<DESCRIPTOR>()>{};
+  }
+};
+
+/// Sum of cubed deviations from the mean of each component of QUANTITY
+template <typename QUANTITY>
+struct M3 : public descriptors::FIELD_BASE_CUSTOM_SIZE {
+  template <typename DESCRIPTOR>
+  static constexpr unsigned size() {
+    return QUANTITY::template size<DESCRIPTOR>();
+  }
+
+  template <typename T, typename DESCRIPTOR>
+  static constexpr auto getInitialValue() {
+    return Vector<value_type<T>, size<DESCRIPTOR>()>{};
+  }
+};
+
+}
+
+/// Accumulates running statistics of QUANTITIES in cell fields
+/**
+ * Single-pass Welford update of mean, second co-moments and third moments
+ * (Pébay, 2008) of each QUANTITY, numerically stable over long averaging
+ * periods. Intended to be added to a stage that is executed anyway, e.g.
+ *
+ *   sLattice.addPostProcessor<stage::PostStream>(
+ *     bulkIndicator, meta::id<RunningStatisticsO<statistics::Velocity,statistics::Pressure>>{});
+ *
+ * Accumulation is (re)started by resetting statistics::SAMPLES to zero.
+ * Results are available via the statistics::MEAN, M2 and M3 fields resp.
+ * SuperLatticeRunningCovariance3D and SuperLatticeRunningSkewness3D.
+ **/
+template <typename... QUANTITIES>
+struct RunningStatisticsO {
+  static constexpr OperatorScope scope = OperatorScope::PerCell;
+
+  /// Sample after all other post processors of the stage
+  int getPriority() const {
+    return std::numeric_limits<int>::max();
+  }
+
+  template <typename QUANTITY, typename CELL, typename V, unsigned D>
+  static void update(CELL& cell, V n, V rho, const Vector<V,D>& u) any_platform {
+    using DESCRIPTOR = typename CELL::descriptor_t;
+    constexpr unsigned N = QUANTITY::template size<DESCRIPTOR>();
+
+    const auto x = QUANTITY::template compute<V,DESCRIPTOR>(rho, u);
+    auto mean = cell.template getFieldPointer<statistics::MEAN<QUANTITY>>();
+    auto m2   = cell.template getFieldPointer<statistics::M2<QUANTITY>>();
+    auto m3   = cell.template getFieldPointer<statistics::M3<QUANTITY>>();
+
+    Vector<V,N> delta;
+    Vector<V,N> deltaN;
+    for (unsigned i=0; i < N; ++i) {
+      delta[i] = x[i] - mean[i];
+      deltaN[i] = delta[i] / n;
+    }
+
+    unsigned iM2 = 0;
+    for (unsigned i=0; i < N; ++i) {
+      // Third moment requires the previous second moment
+      m3[i] += delta[i]*deltaN[i]*deltaN[i]*(n-V{1})*(n-V{2}) - V{3}*deltaN[i]*m2[iM2];
+      for (unsigned j=i; j < N; ++j) {
+        m2[iM2++] += delta[i]*deltaN[j]*(n-V{1});
+      }
+      mean[i] += deltaN[i];
+    }
+  }
+
+  template <typename CELL>
+  void apply(CELL& cell) any_platform {
+    using V = typename CELL::value_t;
+    using DESCRIPTOR = typename CELL::descriptor_t;
+
+    V rho{};
+    Vector<V,DESCRIPTOR::d> u{};
+    cell.computeRhoU(rho, u.data());
+
+    const V n = cell.template getField<statistics::SAMPLES>() + V{1};
+    if (n == V{1}) {
+      // Reset accumulators on (re)start
+      (cell.template setField<statistics::MEAN<QUANTITIES>>(
+         statistics::MEAN<QUANTITIES>::template getInitialValue<V,DESCRIPTOR>()), ...);
+      (cell.template setField<statistics::M2<QUANTITIES>>(
+         statistics::M2<QUANTITIES>::template getInitialValue<V,DESCRIPTOR>()), ...);
+      (cell.template setField<statistics::M3<QUANTITIES>>(
+         statistics::M3<QUANTITIES>::template getInitialValue<V,DESCRIPTOR>()), ...);
+    }
+    (update<QUANTITIES>(cell, n, rho, u), ...);
+    cell.template setField<statistics::SAMPLES>(n);
+  }
+};
+
+}
+
+#endif
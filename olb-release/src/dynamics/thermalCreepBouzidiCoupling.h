@@ -132,8 +132,6 @@ struct ThermalCreepBouzidiCoupling {
     cellADE.template setField<descriptors::VELOCITY>(u);
 
     auto normal = cellNSE.template getField<descriptors::NORMAL>();
-    auto bouzidiVel =
-        cellNSE.template getFieldPointer<descriptors::BOUZIDI_VELOCITY>();
     //auto creepPopulations = cellNSE.template getFieldPointer<descriptors::BOUZIDI_SLIP_CREEP>();
     auto thermal_creep =
         cellNSE.template getFieldPointer<descriptors::AVERAGE_VELOCITY>();
@@ -213,20 +211,26 @@ struct ThermalCreepBouzidiCoupling {
       thermal_creep = u_creep_phys;
       u_creep_latt  = u_creep_phys / conversionVelocity;
 
+      // Read by value as mutable access to the sparse BOUZIDI_VELOCITY
+      // would assign a slot for every visited cell
+      auto bouzidiVel = cellNSE.template getField<descriptors::BOUZIDI_VELOCITY>();
+      bool hasBouzidiLink = false;
+
       // Loop over Lattice directions
       for (int iPop = 1; iPop < DESCRIPTOR::q; ++iPop) {
         const int  iPop_opposite = descriptors::opposite<DESCRIPTOR>(iPop);
-        const auto opp_bouzidi_dist =
-            cellNSE.template getFieldComponent<descriptors::BOUZIDI_DISTANCE>(
-                iPop_opposite);
-        if (opp_bouzidi_dist >= 0) {
+        if (q[iPop_opposite] >= 0) {
           const auto c = descriptors::c<DESCRIPTOR>(iPop_opposite);
           //V          vel_creep_coeff = c * (u_creep_latt + u);
           V vel_creep_coeff = c * u_creep_latt;
           //creepPopulations[iPop_opposite] = vel_creep_coeff;
           bouzidiVel[iPop_opposite] += vel_creep_coeff;
+          hasBouzidiLink = true;
         }
       }
+      if (hasBouzidiLink) {
+        cellNSE.template setField<descriptors::BOUZIDI_VELOCITY>(bouzidiVel);
+      }
     }
     // Write new Bouzidi velocity on cells
     applyBouzidiVelocity(cellNSE);
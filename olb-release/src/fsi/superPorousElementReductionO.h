@@ -109,7 +109,7 @@ public:
       _rankDoesFSI |= sLattice.getBlock(iC).hasPostProcessor(typeid(stage::fsi::CollectFromFluid),
                                                              meta::id<IntegratePorousElementFieldsO<FIELDS...>>{});
     }
-    MPI_Comm_split(MPI_COMM_WORLD, _rankDoesFSI ? 0 : MPI_UNDEFINED, singleton::mpi().getRank(), &_mpiCommunicator);
+    MPI_Comm_split(singleton::mpi().getCommunicator(), _rankDoesFSI ? 0 : MPI_UNDEFINED, singleton::mpi().getRank(), &_mpiCommunicator);
     #endif
 
     {
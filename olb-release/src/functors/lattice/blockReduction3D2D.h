@@ -67,8 +67,25 @@ private:
   /// Reduction mode, see BlockDataReductionMode enum for further information.
   const BlockDataReductionMode _reductionMode;
 
-  void updateBlockAnalytical(BlockData<2,T,T>& block);
-  void updateBlockDiscrete(BlockData<2,T,T>& block);
+  /// Sparse interpolation operator of the rank local subplane in CSR format
+  /**
+   * Row i of the operator lists the (lattice cell, weight) pairs contributing
+   * to the i-th point of _rankLocalSubplane. Cells are shared by neighboring
+   * plane points and are thus evaluated only once per update.
+   **/
+  std::vector<std::size_t> _stencilOffsets;
+  std::vector<std::size_t> _stencilIndices;
+  std::vector<T>           _stencilWeights;
+  /// Distinct cells referenced by the stencils as (local cuboid, lattice position)
+  std::vector<std::pair<int,LatticeR<3>>> _stencilCells;
+  /// Functor values of _stencilCells
+  std::vector<T> _stencilValues;
+  /// Persistent rank local data to be reduced
+  std::unique_ptr<BlockData<2,T,T>> _localBlockData;
+
+  /// Builds the interpolation operator of the current _rankLocalSubplane
+  void initializeStencils();
+  void updateBlock(BlockData<2,T,T>& block);
 
 public:
   /// Construction using functor and hyperplane lattice
@@ -154,6 +171,13 @@ public:
 
   /// Initialize rank-local list of plane points to be stored in _blockData
   void initialize();
+  /// Restrict the rank-local plane points to those for which predicate(iX,iY) holds
+  /**
+   * Points that are not of interest, e.g. outside of a plane integration domain,
+   * are excluded from all subsequent updates and remain zero.
+   **/
+  template <typename F>
+  void restrictSubplane(F predicate);
   /// Updates and writes the data to _blockData using _rankLocalSubplane
   void update();
   /// Overload of virtual function from class BlockF2D
@@ -27,6 +27,7 @@
 #include "blockReduction3D2D.h"
 
 #include <limits>
+#include <map>
 #include "utilities/omath.h"
 
 #include "utilities/vectorHelpers.h"
@@ -38,51 +39,106 @@ namespace olb {
 
 
 template <typename T>
-void BlockReduction3D2D<T>::updateBlockAnalytical(BlockData<2,T,T>& block)
+void BlockReduction3D2D<T>::initializeStencils()
 {
-  AnalyticalFfromSuperF3D<T> analyticalF(*_f);
-
-  for ( std::tuple<int,int,int>& pos : _rankLocalSubplane ) {
-    const int& iX = std::get<0>(pos);
-    const int& iY = std::get<1>(pos);
-    const Vector<T,3> physR = this->getPhysR(iX, iY);
-
-    for ( int iSize = 0; iSize < _f->getTargetDim(); ++iSize ) {
-      block.get({iX, iY}, iSize) = T();
+  const auto& geometry = _f->getSuperStructure().getCuboidDecomposition();
+  LoadBalancer<T>& load = _f->getSuperStructure().getLoadBalancer();
+
+  _stencilOffsets.clear();
+  _stencilIndices.clear();
+  _stencilWeights.clear();
+  _stencilCells.clear();
+
+  std::map<std::tuple<int,int,int,int>, std::size_t> cellIndex;
+  auto addToStencil = [&](int iC, LatticeR<3> latticeR, T weight) {
+    auto [cell, inserted] = cellIndex.try_emplace({iC, latticeR[0], latticeR[1], latticeR[2]},
+                                                  _stencilCells.size());
+    if (inserted) {
+      _stencilCells.emplace_back(iC, latticeR);
     }
+    _stencilIndices.emplace_back(cell->second);
+    _stencilWeights.emplace_back(weight);
+  };
 
-    T output[_f->getTargetDim()];
-    const T input[3] { physR[0], physR[1], physR[2] };
-
-    if (analyticalF(output, input)) {
-      for ( int iSize = 0; iSize < _f->getTargetDim(); ++iSize ) {
-        block.get({iX, iY}, iSize) += output[iSize];
+  _stencilOffsets.emplace_back(0);
+  for ( std::tuple<int,int,int>& pos : _rankLocalSubplane ) {
+    const Vector<T,3> physR = this->getPhysR(std::get<0>(pos), std::get<1>(pos));
+
+    switch ( _reductionMode ) {
+    case BlockDataReductionMode::Analytical: {
+      // Trilinear interpolation averaged over all local cuboids containing physR
+      // (cf. AnalyticalFfromSuperF3D)
+      std::vector<std::tuple<int,LatticeR<3>,Vector<T,3>>> contributions;
+      for (int iC = 0; iC < load.size(); ++iC) {
+        const auto& cuboid = geometry.get(load.glob(iC));
+        const auto latticeR = cuboid.getFloorLatticeR(physR);
+        const auto& block = _f->getBlockF(iC).getBlockStructure();
+        const int padding = std::min(1, block.getPadding());
+        if (latticeR >= -padding && latticeR < block.getExtent()+padding-1) {
+          contributions.emplace_back(iC, latticeR, (physR - cuboid.getPhysR(latticeR)) * (1. / cuboid.getDeltaR()));
+        }
+      }
+      for (auto& [iC, latticeR, d] : contributions) {
+        for (int iNeighbor = 0; iNeighbor < 8; ++iNeighbor) {
+          const LatticeR<3> offset {iNeighbor & 1, (iNeighbor >> 1) & 1, (iNeighbor >> 2) & 1};
+          T weight = T{1} / contributions.size();
+          for (int iD = 0; iD < 3; ++iD) {
+            weight *= offset[iD] ? d[iD] : 1. - d[iD];
+          }
+          addToStencil(iC, latticeR + offset, weight);
+        }
       }
+      break;
     }
+    case BlockDataReductionMode::Discrete: {
+      const int iC = std::get<2>(pos);
+      addToStencil(load.loc(iC), geometry.get(iC).getLatticeR(physR), 1);
+      break;
+    }
+    }
+
+    _stencilOffsets.emplace_back(_stencilIndices.size());
   }
+
+  _stencilValues.resize(_stencilCells.size() * _f->getTargetDim());
 }
 
 template <typename T>
-void BlockReduction3D2D<T>::updateBlockDiscrete(BlockData<2,T,T>& block)
+void BlockReduction3D2D<T>::updateBlock(BlockData<2,T,T>& block)
 {
-  auto& geometry = _f->getSuperStructure().getCuboidDecomposition();
-
-  for ( std::tuple<int,int,int>& pos : _rankLocalSubplane ) {
-    const int& iX = std::get<0>(pos);
-    const int& iY = std::get<1>(pos);
-    const int& iC = std::get<2>(pos);
-    const Vector<T,3> physR = this->getPhysR(iX, iY);
+  const int targetDim = _f->getTargetDim();
+  LoadBalancer<T>& load = _f->getSuperStructure().getLoadBalancer();
+
+  // Gather functor values of all distinct stencil cells
+  for (std::size_t iCell = 0; iCell < _stencilCells.size(); ++iCell) {
+    auto& [iC, latticeR] = _stencilCells[iCell];
+    T* value = _stencilValues.data() + iCell*targetDim;
+    std::fill_n(value, targetDim, T());
+    switch ( _reductionMode ) {
+    case BlockDataReductionMode::Analytical:
+      _f->getBlockF(iC)(value, latticeR.data());
+      break;
+    case BlockDataReductionMode::Discrete: {
+      auto input = latticeR.withPrefix(load.glob(iC));
+      if (!_f(value, input.data())) {
+        std::fill_n(value, targetDim, T());
+      }
+      break;
+    }
+    }
+  }
 
-    for ( int iSize = 0; iSize < _f->getTargetDim(); ++iSize ) {
+  // Apply sparse interpolation operator
+  for (std::size_t iPoint = 0; iPoint < _rankLocalSubplane.size(); ++iPoint) {
+    const int iX = std::get<0>(_rankLocalSubplane[iPoint]);
+    const int iY = std::get<1>(_rankLocalSubplane[iPoint]);
+    for ( int iSize = 0; iSize < targetDim; ++iSize ) {
       block.get({iX, iY}, iSize) = T();
     }
-
-    T output[_f->getTargetDim()];
-    auto input = geometry.get(iC).getLatticeR(physR).withPrefix(iC);
-
-    if (_f(output, input.data())) {
-      for ( int iSize = 0; iSize < _f->getTargetDim(); ++iSize ) {
-        block.get({iX, iY}, iSize) += output[iSize];
+    for (std::size_t i = _stencilOffsets[iPoint]; i < _stencilOffsets[iPoint+1]; ++i) {
+      const T* value = _stencilValues.data() + _stencilIndices[i]*targetDim;
+      for ( int iSize = 0; iSize < targetDim; ++iSize ) {
+        block.get({iX, iY}, iSize) += _stencilWeights[i] * value[iSize];
       }
     }
   }
@@ -210,6 +266,27 @@ void BlockReduction3D2D<T>::initialize()
       }
     }
   }
+
+  initializeStencils();
+}
+
+template <typename T>
+template <typename F>
+void BlockReduction3D2D<T>::restrictSubplane(F predicate)
+{
+  std::erase_if(_rankLocalSubplane, [&](const std::tuple<int,int,int>& pos) {
+    return !predicate(std::get<0>(pos), std::get<1>(pos));
+  });
+  initializeStencils();
+  // Excluded points must not retain previous values
+  _localBlockData.reset();
+  for ( int iX = 0; iX < this->getNx(); ++iX ) {
+    for ( int iY = 0; iY < this->getNy(); ++iY ) {
+      for ( int iSize = 0; iSize < this->getTargetDim(); ++iSize ) {
+        this->getBlockData().get({iX, iY}, iSize) = T();
+      }
+    }
+  }
 }
 
 template <typename T>
@@ -218,43 +295,32 @@ void BlockReduction3D2D<T>::update()
   _f->getSuperStructure().communicate();
 
 #ifdef PARALLEL_MODE_MPI
-  std::unique_ptr<BlockData<2,T,T>> localBlockData(
-    new BlockData<2,T,T>({{this->getNx(), this->getNy()}, 0}, _f->getTargetDim()));
+  if ( _syncMode == BlockDataSyncMode::None ) {
+    // rank local data is the result, points of other ranks remain zero
+    updateBlock(this->getBlockData());
+    return;
+  }
 
-  switch ( _reductionMode ) {
-  case BlockDataReductionMode::Analytical:
-    updateBlockAnalytical(*localBlockData);
-    break;
-  case BlockDataReductionMode::Discrete:
-    updateBlockDiscrete(*localBlockData);
-    break;
+  // only rank local points are written, all others remain zero for the reduction
+  if ( !_localBlockData ) {
+    _localBlockData.reset(
+      new BlockData<2,T,T>({{this->getNx(), this->getNy()}, 0}, _f->getTargetDim()));
   }
+  updateBlock(*_localBlockData);
 
   switch ( _syncMode ) {
   case BlockDataSyncMode::ReduceAndBcast:
-    singleton::mpi().reduce(*localBlockData, this->getBlockData(), MPI_SUM);
+    singleton::mpi().reduce(*_localBlockData, this->getBlockData(), MPI_SUM);
     singleton::mpi().bCast(this->getBlockData());
     break;
   case BlockDataSyncMode::ReduceOnly:
-    singleton::mpi().reduce(*localBlockData, this->getBlockData(), MPI_SUM);
+    singleton::mpi().reduce(*_localBlockData, this->getBlockData(), MPI_SUM);
     break;
-  case BlockDataSyncMode::None:
-    if (this->_owning) {
-      delete this->_blockData;
-    }
-    this->_blockData = localBlockData.release();
-    this->_owning = true;
+  default:
     break;
   }
 #else
-  switch ( _reductionMode ) {
-  case BlockDataReductionMode::Analytical:
-    updateBlockAnalytical(this->getBlockData());
-    break;
-  case BlockDataReductionMode::Discrete:
-    updateBlockDiscrete(this->getBlockData());
-    break;
-  }
+  updateBlock(this->getBlockData());
 #endif
 }
 
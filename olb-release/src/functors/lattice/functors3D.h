@@ -79,6 +79,7 @@
 #include "latticeVolumeFractionApproximation3D.h"
 #include "latticePorosity3D.h"
 #include "latticeField3D.h"
+#include "latticeRunningStatistics3D.h"
 #include "latticePhysCorrBoundaryForce3D.h"
 #include "latticePhysHeatFluxBoundary3D.h"
 #include "latticePhysWallShearStress3D.h"
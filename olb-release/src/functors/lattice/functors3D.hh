@@ -79,6 +79,7 @@
 #include "latticeVolumeFractionApproximation3D.hh"
 #include "latticePorosity3D.hh"
 #include "latticeField3D.hh"
+#include "latticeRunningStatistics3D.hh"
 #include "latticePhysCorrBoundaryForce3D.hh"
 #include "latticePhysHeatFluxBoundary3D.hh"
 #include "latticePhysWallShearStress3D.hh"
@@ -110,6 +110,15 @@ SuperPlaneIntegralF3D<T>::SuperPlaneIntegralF3D(
       }
     }
   }
+
+  // only interpolate the points to be integrated on update
+  std::vector<bool> isIntegrated(_reductionF.getNx() * _reductionF.getNy(), false);
+  for ( const std::tuple<int,int>& pos : _rankLocalSubplane ) {
+    isIntegrated[std::get<1>(pos)*_reductionF.getNx() + std::get<0>(pos)] = true;
+  }
+  _reductionF.restrictSubplane([&](int iX, int iY) -> bool {
+    return isIntegrated[iY*_reductionF.getNx() + iX];
+  });
 }
 
 template<typename T>
@@ -266,8 +275,7 @@ SuperPlaneIntegralF3D<T>::SuperPlaneIntegralF3D(
 template<typename T>
 bool SuperPlaneIntegralF3D<T>::operator()(T output[], const int input[])
 {
-  this->getSuperStructure().communicate();
-
+  // communicates the underlying super structure
   _reductionF.update();
 
   const int flowDim = _reductionF.getTargetDim();
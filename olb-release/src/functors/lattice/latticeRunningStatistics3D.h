@@ -0,0 +1,71 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef LATTICE_RUNNING_STATISTICS_3D_H
+#define LATTICE_RUNNING_STATISTICS_3D_H
+
+#include "superBaseF3D.h"
+#include "blockBaseF3D.h"
+#include "dynamics/runningStatistics.h"
+
+namespace olb {
+
+/// functor returns covariance (e.g. Reynolds stresses) of QUANTITY accumulated by RunningStatisticsO
+/**
+ * Output is ordered as util::TensorVal, the mean is available via
+ * SuperLatticeField3D<T,DESCRIPTOR,statistics::MEAN<QUANTITY>>.
+ **/
+template <typename T, typename DESCRIPTOR, typename QUANTITY>
+class SuperLatticeRunningCovariance3D final : public SuperLatticeF3D<T,DESCRIPTOR> {
+public:
+  /// conversionFactor scales the covariance, e.g. squared velocity factor for physical Reynolds stresses
+  SuperLatticeRunningCovariance3D(SuperLattice<T,DESCRIPTOR>& sLattice, T conversionFactor = 1);
+};
+
+/// functor returns covariance of QUANTITY accumulated by RunningStatisticsO
+template <typename T, typename DESCRIPTOR, typename QUANTITY>
+class BlockLatticeRunningCovariance3D final : public BlockLatticeF3D<T,DESCRIPTOR> {
+private:
+  const T _conversionFactor;
+public:
+  BlockLatticeRunningCovariance3D(BlockLattice<T,DESCRIPTOR>& blockLattice, T conversionFactor = 1);
+  bool operator() (T output[], const int input[]) override;
+};
+
+/// functor returns per-component skewness of QUANTITY accumulated by RunningStatisticsO
+template <typename T, typename DESCRIPTOR, typename QUANTITY>
+class SuperLatticeRunningSkewness3D final : public SuperLatticeF3D<T,DESCRIPTOR> {
+public:
+  SuperLatticeRunningSkewness3D(SuperLattice<T,DESCRIPTOR>& sLattice);
+};
+
+/// functor returns per-component skewness of QUANTITY accumulated by RunningStatisticsO
+template <typename T, typename DESCRIPTOR, typename QUANTITY>
+class BlockLatticeRunningSkewness3D final : public BlockLatticeF3D<T,DESCRIPTOR> {
+public:
+  BlockLatticeRunningSkewness3D(BlockLattice<T,DESCRIPTOR>& blockLattice);
+  bool operator() (T output[], const int input[]) override;
+};
+
+}
+#endif
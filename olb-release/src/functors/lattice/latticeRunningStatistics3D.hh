@@ -0,0 +1,104 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef LATTICE_RUNNING_STATISTICS_3D_HH
+#define LATTICE_RUNNING_STATISTICS_3D_HH
+
+#include "latticeRunningStatistics3D.h"
+
+namespace olb {
+
+template<typename T, typename DESCRIPTOR, typename QUANTITY>
+SuperLatticeRunningCovariance3D<T,DESCRIPTOR,QUANTITY>::SuperLatticeRunningCovariance3D(
+  SuperLattice<T,DESCRIPTOR>& sLattice, T conversionFactor)
+  : SuperLatticeF3D<T,DESCRIPTOR>(sLattice, DESCRIPTOR::template size<statistics::M2<QUANTITY>>())
+{
+  this->getName() = "runningCovariance";
+  int maxC = this->_sLattice.getLoadBalancer().size();
+  this->_blockF.reserve(maxC);
+  for (int iC = 0; iC < maxC; iC++) {
+    this->_blockF.emplace_back(
+      new BlockLatticeRunningCovariance3D<T,DESCRIPTOR,QUANTITY>(this->_sLattice.getBlock(iC), conversionFactor));
+  }
+}
+
+template<typename T, typename DESCRIPTOR, typename QUANTITY>
+BlockLatticeRunningCovariance3D<T,DESCRIPTOR,QUANTITY>::BlockLatticeRunningCovariance3D(
+  BlockLattice<T,DESCRIPTOR>& blockLattice, T conversionFactor)
+  : BlockLatticeF3D<T,DESCRIPTOR>(blockLattice, DESCRIPTOR::template size<statistics::M2<QUANTITY>>()),
+    _conversionFactor(conversionFactor)
+{
+  this->getName() = "runningCovariance";
+}
+
+template<typename T, typename DESCRIPTOR, typename QUANTITY>
+bool BlockLatticeRunningCovariance3D<T,DESCRIPTOR,QUANTITY>::operator()(T output[], const int input[])
+{
+  auto cell = this->_blockLattice.get(input[0], input[1], input[2]);
+  const T n = cell.template getField<statistics::SAMPLES>();
+  cell.template computeField<statistics::M2<QUANTITY>>(output);
+  for (int i=0; i < this->getTargetDim(); ++i) {
+    output[i] = n > 0 ? _conversionFactor * output[i] / n : T{};
+  }
+  return true;
+}
+
+template<typename T, typename DESCRIPTOR, typename QUANTITY>
+SuperLatticeRunningSkewness3D<T,DESCRIPTOR,QUANTITY>::SuperLatticeRunningSkewness3D(
+  SuperLattice<T,DESCRIPTOR>& sLattice)
+  : SuperLatticeF3D<T,DESCRIPTOR>(sLattice, DESCRIPTOR::template size<statistics::M3<QUANTITY>>())
+{
+  this->getName() = "runningSkewness";
+  int maxC = this->_sLattice.getLoadBalancer().size();
+  this->_blockF.reserve(maxC);
+  for (int iC = 0; iC < maxC; iC++) {
+    this->_blockF.emplace_back(
+      new BlockLatticeRunningSkewness3D<T,DESCRIPTOR,QUANTITY>(this->_sLattice.getBlock(iC)));
+  }
+}
+
+template<typename T, typename DESCRIPTOR, typename QUANTITY>
+BlockLatticeRunningSkewness3D<T,DESCRIPTOR,QUANTITY>::BlockLatticeRunningSkewness3D(
+  BlockLattice<T,DESCRIPTOR>& blockLattice)
+  : BlockLatticeF3D<T,DESCRIPTOR>(blockLattice, DESCRIPTOR::template size<statistics::M3<QUANTITY>>())
+{
+  this->getName() = "runningSkewness";
+}
+
+template<typename T, typename DESCRIPTOR, typename QUANTITY>
+bool BlockLatticeRunningSkewness3D<T,DESCRIPTOR,QUANTITY>::operator()(T output[], const int input[])
+{
+  auto cell = this->_blockLattice.get(input[0], input[1], input[2]);
+  const T n = cell.template getField<statistics::SAMPLES>();
+  auto m2 = cell.template getFieldPointer<statistics::M2<QUANTITY>>();
+  auto m3 = cell.template getFieldPointer<statistics::M3<QUANTITY>>();
+  const int N = this->getTargetDim();
+  // Diagonal entries of the co-moment tensor
+  for (int i=0, iM2=0; i < N; iM2 += N-i, ++i) {
+    output[i] = m2[iM2] > 0 ? util::sqrt(n) * m3[i] / util::pow(m2[iM2], T{1.5}) : T{};
+  }
+  return true;
+}
+
+}
+#endif
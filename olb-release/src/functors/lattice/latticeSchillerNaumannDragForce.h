@@ -63,6 +63,11 @@ public:
                                Vector<bool,DESCRIPTOR::d> periodic = Vector<bool,DESCRIPTOR::d> (false),
                                std::size_t iP0=0 );
   void evaluate(T output[], particles::Particle<T,PARTICLETYPE>& particle, int iP);
+  /// Evaluate and apply force for all particles meeting PCONDITION at once
+  /// - operates on the SoA particle storage, fluid velocities are interpolated
+  ///   concurrently and the drag law is vectorized over all particles
+  template <typename PCONDITION>
+  void evaluateAll();
   bool operator() (T output[], const int input[]) override;
   static constexpr bool serializeForce = false;
 };
@@ -113,6 +113,90 @@ void BlockLatticeSchillerNaumannDragForce<T, DESCRIPTOR, PARTICLETYPE>::evaluate
 }
 
 
+template<typename T, typename DESCRIPTOR, typename PARTICLETYPE>
+template<typename PCONDITION>
+void BlockLatticeSchillerNaumannDragForce<T, DESCRIPTOR, PARTICLETYPE>::evaluateAll()
+{
+  constexpr unsigned D = DESCRIPTOR::d;
+  using namespace descriptors;
+  static_assert(PARTICLETYPE::template providesNested<MOBILITY, FLUIDVEL>(), "Field MOBILITY:FLUIDVEL has to be provided");
+
+  const std::size_t nP = _particleSystem.size() - _iP0;
+  if (nP == 0) {
+    return;
+  }
+
+  //Retrieve SoA particle fields
+  auto& velocityF = _particleSystem.template getFieldD<MOBILITY,VELOCITY>();
+  auto& fluidVelF = _particleSystem.template getFieldD<MOBILITY,FLUIDVEL>();
+  auto& radiusF   = _particleSystem.template getFieldD<PHYSPROPERTIES,RADIUS>();
+  auto& massF     = _particleSystem.template getFieldD<PHYSPROPERTIES,MASS>();
+  auto& forceF    = _particleSystem.template getFieldD<FORCING,FORCE>();
+
+  const auto& cuboid = _blockGeometry.getCuboid();
+  std::vector<char> active(nP, 0);
+
+  //Interpolate fluid velocity at particle positions (one functor per thread)
+  #ifdef PARALLEL_MODE_OMP
+  #pragma omp parallel
+  #endif
+  {
+    BlockLatticeInterpPhysVelocity<T,DESCRIPTOR> blockInterpPhysVelF(
+      _blockLattice, this->_converter, cuboid);
+    #ifdef PARALLEL_MODE_OMP
+    #pragma omp for schedule(static)
+    #endif
+    for (std::size_t i=0; i < nP; ++i) {
+      auto particle = _particleSystem.get(_iP0+i);
+      particles::doWhenMeetingCondition<T,PARTICLETYPE,PCONDITION>( particle, [&](){
+        Vector<T,D> position = particle.template getField<GENERAL,POSITION>();
+        //Check whether inside cuboid (when not parallelized)
+        if constexpr ( !particles::access::providesParallelization<PARTICLETYPE>() ){
+          if (!cuboid.isInside(position)) {
+            return;
+          }
+        }
+        T fluidVelArray[D] = {0.};
+        blockInterpPhysVelF(fluidVelArray, position.data());
+        particle.template setField<MOBILITY, FLUIDVEL>(fluidVelArray);
+        active[i] = 1;
+      });
+    }
+  }
+
+  const T viscosity = this->_converter.getPhysViscosity();
+  const T fluidDensity = this->_converter.getPhysDensity();
+
+  //Calculate SchillerNaumann force for all particles (vectorizable, inactive particles keep their force)
+  // C_d*Re_p/24 is evaluated directly to avoid the division by Re_p
+  #ifdef PARALLEL_MODE_OMP
+  #pragma omp parallel for simd schedule(static)
+  #endif
+  for (std::size_t i=0; i < nP; ++i) {
+    const std::size_t iP = _iP0 + i;
+    const T radius = radiusF[0][iP];
+    const T mass = massF[0][iP];
+    const T part_density = mass / (4./3.*M_PI*radius*radius*radius);
+    const T Coeff = 18 * viscosity * fluidDensity / (part_density*2*radius*2*radius);
+
+    T relVelSqr = 0;
+    for (unsigned iDim=0; iDim < D; ++iDim) {
+      const T relVel = velocityF[iDim][iP] - fluidVelF[iDim][iP];
+      relVelSqr += relVel * relVel;
+    }
+    const T Re_p = util::sqrt(relVelSqr) * 2 * radius / viscosity;
+    const T C_dRe_p = Re_p < 0.0000000001 ? T{0}
+                    : (Re_p < 1000 ? T{24} * (1 + 0.15*util::pow(Re_p, 0.687))
+                                   : T{0.44} * Re_p);
+
+    for (unsigned iDim=0; iDim < D; ++iDim) {
+      const T force = C_dRe_p * Coeff * (fluidVelF[iDim][iP] - velocityF[iDim][iP]) * mass / 24.;
+      forceF[iDim][iP] = active[i] ? force : forceF[iDim][iP];
+    }
+  }
+}
+
+
 
 template<typename T, typename DESCRIPTOR, typename PARTICLETYPE>
 bool BlockLatticeSchillerNaumannDragForce<T, DESCRIPTOR, PARTICLETYPE>::operator()(T output[], const int input[])
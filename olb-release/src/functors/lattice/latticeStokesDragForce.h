@@ -65,6 +65,12 @@ public:
                                const F f = [](auto&, const auto&, const auto&, const auto&){}
                                );
   void evaluate(T output[], particles::Particle<T,PARTICLETYPE>& particle, int iP);
+  /// Evaluate and apply force for all particles meeting PCONDITION at once
+  /// - operates on the SoA particle storage, fluid velocities are interpolated
+  ///   concurrently and the drag law is vectorized over all particles
+  /// - only available if the force is applied directly (serialize=false)
+  template <typename PCONDITION>
+  void evaluateAll() requires (!serialize);
   bool operator() (T output[], const int input[]) override;
   static constexpr bool serializeForce = serialize; //Return serialized force values via output[]
 };
@@ -122,6 +122,88 @@ void BlockLatticeStokesDragForce<T, DESCRIPTOR, PARTICLETYPE, serialize>::evalua
 }
 
 
+template<typename T, typename DESCRIPTOR, typename PARTICLETYPE, bool serialize>
+template<typename PCONDITION>
+void BlockLatticeStokesDragForce<T, DESCRIPTOR, PARTICLETYPE, serialize>::evaluateAll()
+  requires (!serialize)
+{
+  constexpr unsigned D = DESCRIPTOR::d;
+  using namespace descriptors;
+
+  const std::size_t nP = _particleSystem.size() - _iP0;
+  if (nP == 0) {
+    return;
+  }
+
+  //Retrieve SoA particle fields
+  auto& velocityF = _particleSystem.template getFieldD<MOBILITY,VELOCITY>();
+  auto& radiusF   = _particleSystem.template getFieldD<PHYSPROPERTIES,RADIUS>();
+  auto& massF     = _particleSystem.template getFieldD<PHYSPROPERTIES,MASS>();
+  auto& forceF    = _particleSystem.template getFieldD<FORCING,FORCE>();
+
+  const auto& cuboid = _blockGeometry.getCuboid();
+  std::vector<char> active(nP, 0);
+  std::vector<T> fluidVel(D*nP, T{0});
+
+  //Interpolate fluid velocity at particle positions (one functor per thread)
+  #ifdef PARALLEL_MODE_OMP
+  #pragma omp parallel
+  #endif
+  {
+    BlockLatticeInterpPhysVelocity<T,DESCRIPTOR> blockInterpPhysVelF(
+      _blockLattice, this->_converter, cuboid);
+    #ifdef PARALLEL_MODE_OMP
+    #pragma omp for schedule(static)
+    #endif
+    for (std::size_t i=0; i < nP; ++i) {
+      auto particle = _particleSystem.get(_iP0+i);
+      particles::doWhenMeetingCondition<T,PARTICLETYPE,PCONDITION>( particle, [&](){
+        Vector<T,D> position = particle.template getField<GENERAL,POSITION>();
+        //Check whether inside cuboid (when not parallelized)
+        if constexpr ( !particles::access::providesParallelization<PARTICLETYPE>() ){
+          if (!cuboid.isInside(position)) {
+            return;
+          }
+        }
+        blockInterpPhysVelF(&fluidVel[D*i], position.data());
+        active[i] = 1;
+      });
+    }
+  }
+
+  //Calculate stokes force for all particles (vectorizable, inactive particles keep their force)
+  #ifdef PARALLEL_MODE_OMP
+  #pragma omp parallel for simd schedule(static)
+  #endif
+  for (std::size_t i=0; i < nP; ++i) {
+    const std::size_t iP = _iP0 + i;
+    const T mass = massF[0][iP];
+    const T c = _C1 * radiusF[0][iP] / mass;
+    const T C2 = T{1} / (T{1} + c);
+    for (unsigned iDim=0; iDim < D; ++iDim) {
+      const T velocity = velocityF[iDim][iP];
+      const T force = mass * _delTinv
+        * ((c * fluidVel[D*i+iDim] + velocity) * C2 - velocity);
+      forceF[iDim][iP] = active[i] ? force : forceF[iDim][iP];
+    }
+  }
+
+  //Record interpolated fluid field and call optional per particle function
+  for (std::size_t i=0; i < nP; ++i) {
+    if (active[i]) {
+      auto particle = _particleSystem.get(_iP0+i);
+      if constexpr( PARTICLETYPE::template providesNested<MOBILITY,FLUIDVEL>() ){
+        particle.template setField<MOBILITY, FLUIDVEL>(Vector<T,D>(&fluidVel[D*i]));
+      }
+      Vector<T,D> position = particle.template getField<GENERAL,POSITION>();
+      Vector<T,D> force = particle.template getField<FORCING,FORCE>();
+      _f(particle, position, force, Vector<T,utilities::dimensions::convert<D>::rotation>(T{0}));
+      particle.template setField<FORCING,FORCE>( force );
+    }
+  }
+}
+
+
 
 template<typename T, typename DESCRIPTOR, typename PARTICLETYPE, bool serialize>
 bool BlockLatticeStokesDragForce<T, DESCRIPTOR, PARTICLETYPE, serialize>::operator()(T output[], const int input[])
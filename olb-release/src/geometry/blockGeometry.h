@@ -30,6 +30,7 @@
 #define BLOCK_GEOMETRY_H
 
 #include <vector>
+#include <optional>
 
 #include "core/blockStructure.h"
 #include "core/fieldArrayD.hh"
@@ -42,6 +43,19 @@
 namespace olb {
 
 
+/// Material modification deferred by SuperGeometry::beginEdit
+template <typename T, unsigned D>
+struct BlockGeometryEdit {
+  /// Material to be replaced, any material if empty
+  std::optional<int> fromM;
+  /// Material to be assigned
+  int toM;
+  /// Indicator restricting the modification, none if nullptr
+  IndicatorF<T,D>* condition;
+  /// Restricts modification to the bounding box of condition incl. padding instead of all core cells
+  bool bounded;
+};
+
 /// Representation of a block geometry
 /**
  * This class is derived from block geometry structure. It
@@ -180,6 +194,11 @@ public:
   void rename(int fromM, int toM, int fluidM, IndicatorF<T,D>& condition, Vector<int,D> discreteNormal);
   /// Replaces all material numbers (fromM) to another (toM) if all materials in the neighbourhood (iX+discreteNormal[0],iX+2*discreteNormal[0]), .. are of another material number (fluidM) and if an indicator functor condition is fulfilled, the discreteNormal is computed from all fromM which fulfill the indicator functor condition
   void rename(int fromM, int toM, int fluidM, IndicatorF<T,D>& condition);
+  /// Applies a sequence of edits in a single sweep, equivalent to applying them one after another
+  /**
+   * Cells are visited bin-wise, only edits whose bounding box overlaps a bin are evaluated.
+   **/
+  void apply(const std::vector<BlockGeometryEdit<T,D>>& edits);
 
   /// Copy a layer of material numbers inside an indicator in a discrete normal direction
   void copyMaterialLayer(IndicatorF3D<T>& condition, int discreteNormal[D], int numberOfLayers);
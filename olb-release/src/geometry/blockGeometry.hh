@@ -310,10 +310,10 @@ template<typename T, unsigned D>
 void BlockGeometry<T,D>::reset(IndicatorF<T,D>& domain)
 {
   this->forCoreSpatialLocations([&](LatticeR<D> latticeR) {
-    T physR[D] { };
+    Vector<T,D> physR;
     bool output{};
     getPhysR(physR, latticeR);
-    domain(&output, physR);
+    domain(&output, physR.data());
     if (output) {
       set(latticeR, 0);
     }
@@ -432,6 +432,139 @@ void BlockGeometry<T, D>::rename(int fromM, int toM, IndicatorF<T, D>& condition
     }
   });
 }
+template<typename T, unsigned D>
+void BlockGeometry<T,D>::apply(const std::vector<BlockGeometryEdit<T,D>>& edits)
+{
+  // Edge length of the bins indexing the edits by their bounding boxes
+  constexpr int binSize = 8;
+
+  const int padding = this->getPadding();
+  const LatticeR<D> core = this->getExtent();
+
+  // Lattice bounding boxes of all edits restricted to the block
+  std::vector<LatticeR<D>> editMin(edits.size());
+  std::vector<LatticeR<D>> editMax(edits.size());
+  std::vector<bool> editEmpty(edits.size(), false);
+  for (std::size_t iEdit=0; iEdit < edits.size(); ++iEdit) {
+    const auto& edit = edits[iEdit];
+    if (edit.bounded) {
+      editMin[iEdit] = _cuboid.getLatticeR(edit.condition->getMin());
+      editMax[iEdit] = _cuboid.getLatticeR(edit.condition->getMax());
+    }
+    for (unsigned iD=0; iD < D; ++iD) {
+      if (edit.bounded) {
+        editMin[iEdit][iD] = std::max(editMin[iEdit][iD], -padding);
+        editMax[iEdit][iD] = std::min(editMax[iEdit][iD], core[iD] + padding - 1);
+      } else {
+        editMin[iEdit][iD] = 0;
+        editMax[iEdit][iD] = core[iD] - 1;
+      }
+      editEmpty[iEdit] = editEmpty[iEdit] || editMin[iEdit][iD] > editMax[iEdit][iD];
+    }
+  }
+
+  LatticeR<D> nBins;
+  std::size_t nBinsTotal = 1;
+  for (unsigned iD=0; iD < D; ++iD) {
+    nBins[iD] = (core[iD] + 2*padding + binSize - 1) / binSize;
+    nBinsTotal *= nBins[iD];
+  }
+  auto forBinsOf = [&](std::size_t iEdit, auto f) {
+    LatticeR<D> binMin, binMax;
+    for (unsigned iD=0; iD < D; ++iD) {
+      binMin[iD] = (editMin[iEdit][iD] + padding) / binSize;
+      binMax[iD] = (editMax[iEdit][iD] + padding) / binSize;
+    }
+    LatticeR<D> bin = binMin;
+    while (true) {
+      std::size_t iBin = 0;
+      for (unsigned iD=0; iD < D; ++iD) {
+        iBin = iBin * nBins[iD] + bin[iD];
+      }
+      f(iBin);
+      unsigned iD = D;
+      while (iD > 0 && ++bin[iD-1] > binMax[iD-1]) {
+        bin[iD-1] = binMin[iD-1];
+        iD -= 1;
+      }
+      if (iD == 0) {
+        return;
+      }
+    }
+  };
+
+  // Candidate edits of each bin in CSR format, ascending in application order
+  std::vector<std::size_t> binOffsets(nBinsTotal+1, 0);
+  for (std::size_t iEdit=0; iEdit < edits.size(); ++iEdit) {
+    if (!editEmpty[iEdit]) {
+      forBinsOf(iEdit, [&](std::size_t iBin) { binOffsets[iBin+1] += 1; });
+    }
+  }
+  for (std::size_t iBin=0; iBin < nBinsTotal; ++iBin) {
+    binOffsets[iBin+1] += binOffsets[iBin];
+  }
+  std::vector<std::size_t> binEdits(binOffsets.back());
+  {
+    std::vector<std::size_t> binFill(binOffsets.begin(), binOffsets.end()-1);
+    for (std::size_t iEdit=0; iEdit < edits.size(); ++iEdit) {
+      if (!editEmpty[iEdit]) {
+        forBinsOf(iEdit, [&](std::size_t iBin) { binEdits[binFill[iBin]++] = iEdit; });
+      }
+    }
+  }
+
+  Vector<T,D> physR;
+  for (std::size_t iBin=0; iBin < nBinsTotal; ++iBin) {
+    if (binOffsets[iBin] == binOffsets[iBin+1]) {
+      continue;
+    }
+    // Restrict the bin to the union of its candidates' bounding boxes
+    LatticeR<D> min, max;
+    std::size_t iBinRemainder = iBin;
+    for (int iD=D-1; iD >= 0; --iD) {
+      const int binOrigin = int(iBinRemainder % nBins[iD]) * binSize - padding;
+      iBinRemainder /= nBins[iD];
+      min[iD] = core[iD] + padding;
+      max[iD] = -padding - 1;
+      for (std::size_t i=binOffsets[iBin]; i < binOffsets[iBin+1]; ++i) {
+        min[iD] = std::min(min[iD], editMin[binEdits[i]][iD]);
+        max[iD] = std::max(max[iD], editMax[binEdits[i]][iD]);
+      }
+      min[iD] = std::max(min[iD], binOrigin);
+      max[iD] = std::min(max[iD], binOrigin + binSize - 1);
+    }
+    this->forSpatialLocations(min, max, [&](LatticeR<D> latticeR) {
+      const int material = get(latticeR);
+      int result = material;
+      bool physRKnown = false;
+      for (std::size_t i=binOffsets[iBin]; i < binOffsets[iBin+1]; ++i) {
+        const auto& edit = edits[binEdits[i]];
+        if (edit.fromM && *edit.fromM != result) {
+          continue;
+        }
+        if (!(editMin[binEdits[i]] <= latticeR && latticeR <= editMax[binEdits[i]])) {
+          continue;
+        }
+        if (edit.condition) {
+          if (!physRKnown) {
+            getPhysR(physR, latticeR);
+            physRKnown = true;
+          }
+          bool inside[1];
+          (*edit.condition)(inside, physR.data());
+          if (!inside[0]) {
+            continue;
+          }
+        }
+        result = edit.toM;
+      }
+      if (result != material) {
+        set(latticeR, result);
+      }
+    });
+  }
+}
+
 template<typename T, unsigned D>
 void BlockGeometry<T,D>::rename(int fromM, int toM, LatticeR<D> offset)
 {
@@ -74,6 +74,14 @@ private:
   std::unique_ptr<SuperCommunicator<T,SuperGeometry<T,D>>> _communicator{};
   /// True if changes need to be communicated
   bool _communicationNeeded{};
+  /// True while modifications are deferred until commit
+  bool _editing{};
+  /// Deferred modifications in order of submission
+  std::vector<BlockGeometryEdit<T,D>> _edits;
+  /// Keeps indicators of deferred modifications alive (if owned)
+  std::vector<FunctorPtr<IndicatorF<T,D>>> _editConditions;
+  /// Throws for modifications that can not be deferred while editing
+  void throwIfEditing(const std::string& method) const;
   /// Statistic class
   SuperGeometryStatistics<T,D> _statistics{};
   /// class specific output stream
@@ -148,6 +156,24 @@ public:
   /// check for errors (searches for all outer voxels (=0) with an inner voxel (=1) as a direct neighbour)
   bool checkForErrors(bool verbose=true);
 
+  /// Defers reset and rename by material resp. indicator until commit
+  /**
+   * Geometries that are composed of many indicators (e.g. OSMParser) otherwise pay
+   * for one sweep, one communication and one incremental VTK output per modification.
+   *
+   * Indicators that are passed by reference must stay alive until commit.
+   * Other modifications (e.g. clean or boundary renames depending on the
+   * current material layout) throw std::logic_error until commit.
+   * Queries must not be used until commit.
+   **/
+  void beginEdit();
+  /// Applies all deferred modifications in a single sweep per block
+  /**
+   * Result is identical to applying the modifications one after another.
+   * Communicates and updates the statistics status only once.
+   **/
+  void commit();
+
   /// reset all cell materials inside of a domain to 0
   void reset(IndicatorF<T,D>& domain);
 
@@ -33,6 +33,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <stdexcept>
 
 #include "geometry/cuboid.h"
 #include "geometry/cuboidDecomposition.h"
@@ -205,6 +206,7 @@ template<typename T, unsigned D>
 template<typename DESCRIPTOR>
 int SuperGeometry<T,D>::clean(bool verbose, std::vector<int> bulkMaterials)
 {
+  throwIfEditing("clean");
   this->communicate();
   int counter=0;
   for (unsigned iC=0; iC<_block.size(); iC++) {
@@ -226,6 +228,7 @@ int SuperGeometry<T,D>::clean(bool verbose, std::vector<int> bulkMaterials)
 template<typename T, unsigned D>
 int SuperGeometry<T,D>::outerClean(bool verbose, std::vector<int> bulkMaterials)
 {
+  throwIfEditing("outerClean");
   this->communicate();
   int counter=0;
   for (unsigned iC=0; iC<_block.size(); iC++) {
@@ -247,6 +250,7 @@ int SuperGeometry<T,D>::outerClean(bool verbose, std::vector<int> bulkMaterials)
 template<typename T, unsigned D>
 int SuperGeometry<T,D>::innerClean(bool verbose)
 {
+  throwIfEditing("innerClean");
   this->communicate();
   int counter=0;
   for (unsigned iC=0; iC<_block.size(); iC++) {
@@ -269,6 +273,7 @@ int SuperGeometry<T,D>::innerClean(bool verbose)
 template<typename T, unsigned D>
 int SuperGeometry<T,D>::innerClean(int bcType, bool verbose)
 {
+  throwIfEditing("innerClean");
   this->communicate();
   int counter=0;
   for (unsigned iC=0; iC<_block.size(); iC++) {
@@ -308,9 +313,51 @@ bool SuperGeometry<T,D>::checkForErrors(bool verbose)
   return error;
 }
 
+template<typename T, unsigned D>
+void SuperGeometry<T,D>::throwIfEditing(const std::string& method) const
+{
+  if (_editing) {
+    throw std::logic_error("SuperGeometry::" + method + " can not be deferred, call commit first");
+  }
+}
+
+template<typename T, unsigned D>
+void SuperGeometry<T,D>::beginEdit()
+{
+  if (_editing) {
+    throw std::logic_error("SuperGeometry::beginEdit called while already editing");
+  }
+  _editing = true;
+}
+
+template<typename T, unsigned D>
+void SuperGeometry<T,D>::commit()
+{
+  if (!_editing) {
+    throw std::logic_error("SuperGeometry::commit called without beginEdit");
+  }
+  _editing = false;
+  if (!_edits.empty()) {
+    this->communicate();
+    for (unsigned iC=0; iC < _block.size(); ++iC) {
+      _block[iC]->apply(_edits);
+    }
+    _edits.clear();
+    _editConditions.clear();
+    _statistics.getStatisticsStatus() = true;
+    this->_communicationNeeded = true;
+    this->communicate();
+    writeIncrementalVTK();
+  }
+}
+
 template<typename T, unsigned D>
 void SuperGeometry<T,D>::reset(IndicatorF<T,D>& domain)
 {
+  if (_editing) {
+    _edits.push_back({std::nullopt, 0, &domain, false});
+    return;
+  }
   this->communicate();
   for (unsigned iC = 0; iC < _block.size(); ++iC) {
     _block[iC]->reset(domain);
@@ -323,6 +370,10 @@ void SuperGeometry<T,D>::reset(IndicatorF<T,D>& domain)
 template<typename T, unsigned D>
 void SuperGeometry<T,D>::rename(int fromM, int toM)
 {
+  if (_editing) {
+    _edits.push_back({fromM, toM, nullptr, false});
+    return;
+  }
   this->communicate();
   for (unsigned iC=0; iC<_block.size(); iC++) {
     _block[iC]->rename(fromM,toM);
@@ -335,6 +386,11 @@ void SuperGeometry<T,D>::rename(int fromM, int toM)
 template<typename T, unsigned D>
 void SuperGeometry<T,D>::rename(int fromM, int toM, FunctorPtr<IndicatorF<T,D>>&& condition)
 {
+  if (_editing) {
+    _edits.push_back({fromM, toM, &*condition, true});
+    _editConditions.emplace_back(std::move(condition));
+    return;
+  }
   this->communicate();
   for (unsigned iC=0; iC<_block.size(); iC++) {
     _block[iC]->rename(fromM,toM,*condition);
@@ -346,6 +402,7 @@ void SuperGeometry<T,D>::rename(int fromM, int toM, FunctorPtr<IndicatorF<T,D>>&
 template<typename T, unsigned D>
 void SuperGeometry<T,D>::rename(int fromM, int toM, LatticeR<D> offset)
 {
+  throwIfEditing("rename");
   LatticeR<D> overlap (this->_overlap);
   if ( offset <= overlap ){
     _communicator->communicate();
@@ -363,6 +420,7 @@ void SuperGeometry<T,D>::rename(int fromM, int toM, LatticeR<D> offset)
 template<typename T, unsigned D>
 void SuperGeometry<T,D>::rename(int fromM, int toM, int testM, Vector<int,D> testDirection)
 {
+  throwIfEditing("rename");
   if ( testDirection[0]*testDirection[0]<=(this->_overlap)*(this->_overlap)
         && testDirection[1]*testDirection[1]<=(this->_overlap)*(this->_overlap)  ){
     if constexpr (D==3){
@@ -392,6 +450,7 @@ template<typename T, unsigned D>
 void SuperGeometry<T,D>::rename(int fromBcMat, int toBcMat, int fluidMat,
                                 IndicatorF<T,D>& condition)
 {
+  throwIfEditing("rename");
   if (this->_overlap>1) {
     this->communicate();
     rename(fromBcMat, toBcMat, condition);
@@ -413,6 +472,7 @@ template<typename T, unsigned D>
 void SuperGeometry<T,D>::rename(int fromBcMat, int toBcMat, int fluidMat,
                                 FunctorPtr<IndicatorF<T,D>>&& condition)
 {
+  throwIfEditing("rename");
   if (this->_overlap>1) {
     _communicator->communicate();
     rename(fromBcMat, toBcMat, *condition);
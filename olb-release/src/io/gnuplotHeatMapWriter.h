@@ -27,6 +27,9 @@
 #include <iomanip>
 #include <iostream>
 #include <list>
+#include <string>
+#include <vector>
+#include <cstdint>
 
 #include "functors/lattice/blockReduction3D2D.h"
 #include "functors/lattice/blockReduction2D2D.h"
@@ -48,6 +51,11 @@ struct plotParam {
   Vector<T,2u> zoomExtend;
   T minValue = 0.;
   T maxValue = 0.;
+  /// Render via the built-in PNG rasterizer instead of gnuplot (no contours and axis labels)
+  bool png = false;
+  /// Colour map and encode the built-in PNG output on the background thread pool
+  /// (pending images must be flushed via waitForBackgroundOutput)
+  bool background = false;
 
   plotParam():
     zoomOrigin(0.0, 0.0),
@@ -94,22 +102,42 @@ struct detailParam {
 template <typename T>
 void writeHeatMapDataFile(detailParam<T>& param);
 
+template <typename T>
+void writeHeatMapCSVFile(detailParam<T>& param);
+
 template <typename T>
 void writeHeatMapPlotFile(detailParam<T>& param, const std::vector<T>& valueArea);
 
 template< typename T >
 void executeGnuplot(detailParam<T>& param);
 
+/// Rasterizes the (zoomed) plane data to PNG without external tools
+template <typename T>
+void writeHeatMapPNG(detailParam<T>& param, const std::vector<T>& valueArea);
+
+/// Lookup table of 256 RGB colours for the given colour scheme
+template <typename T>
+std::vector<std::uint8_t> generatePalette(const std::string& colour);
+
 bool gnuplotInstalled();
 
 } // namespace detail
 
-/** This function is used to plot heat maps as jpeg files.
+/// Blocks until all heat maps scheduled for background output are written
+/**
+ * Must be called before the end of the program if plotParam::background is used
+ **/
+inline void waitForBackgroundOutput();
+
+/** This function is used to plot heat maps as jpeg (or png if plotParam::png is set) files.
+ * Setting png rasterizes and encodes the image in-process without gnuplot
+ * (contours and axes are only available in the gnuplot output).
  * minValue and maxValue set a defined scalar range.
  * contourlevel sets the number of contours in the plot.
  * zoomOrigin and zoomExtend set a zoom scale in the plot:
  * (zoomOrigin(0 to 1) and zoomExtend(0 to 1-zoomOrigin)
  * Available colour schemes are "grey", "pm3d", "blackbody" and "rainbow"
+ * as well as "earth", "water", "air", "fire" and "leeloo" for the built-in renderer
  */
 template <typename T>
 void write(BlockReduction3D2D<T>& blockReduction, int iT, const plotParam<T> param = {}, const std::vector<T>& valueArea = std::vector<T>{}) {
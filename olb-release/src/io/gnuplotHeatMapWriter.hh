@@ -26,10 +26,17 @@
 
 #include <fstream>
 #include <iostream>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <numbers>
+#include <optional>
 #include <unistd.h>
 
 #include "core/singleton.h"
 #include "io/fileName.hh"
+#include "io/colormaps.hh"
+#include "io/pngWriter.hh"
 #include "gnuplotHeatMapWriter.h"
 #include "utilities/vectorHelpers.h"
 
@@ -105,9 +112,17 @@ void genericHeatMapInterface(const HyperplaneLattice3D<T>& hyperPlane, BlockF2D<
       if (param.canvasY > 65500)
         param.canvasY = 65499;
       param.cbXscaling = param.canvasX/(double)1000;
-      writeHeatMapDataFile(param);
-      writeHeatMapPlotFile(param, valueArea);
-      executeGnuplot(param);
+      if (plot.png) {
+        if (plot.writeCSV) {
+          writeHeatMapCSVFile(param);
+        }
+        writeHeatMapPNG(param, valueArea);
+      }
+      else {
+        writeHeatMapDataFile(param);
+        writeHeatMapPlotFile(param, valueArea);
+        executeGnuplot(param);
+      }
     }
   }
   return;
@@ -133,23 +148,172 @@ void writeHeatMapDataFile(detailParam<T>& param)
   }
   foutMatrix.close();
 
-
   if (param.plot->writeCSV) {
-    std::ofstream foutCSV( param.csvPath.c_str() );
-    for (i[1] = 0; i[1] < param.ny; i[1]++) {
-      for (i[0] = 0; i[0] < param.nx; i[0]++) {
-        T evaluated[1];
-        Vector<T,3> physPoint = param.hyperPlane->getPhysR(i[0], i[1]);
-        (*param.blockData)(evaluated,i);
-        foutCSV << physPoint[0] << " " << physPoint[1] << " " << physPoint[2] << " " << evaluated[0] << "\n";
-      }
-    }
-    foutCSV.close();
+    writeHeatMapCSVFile(param);
   }
 
   return;
 }
 
+template <typename T>
+void writeHeatMapCSVFile(detailParam<T>& param)
+{
+  std::ofstream foutCSV( param.csvPath.c_str() );
+  int i[2] = {0,0};
+  for (i[1] = 0; i[1] < param.ny; i[1]++) {
+    for (i[0] = 0; i[0] < param.nx; i[0]++) {
+      T evaluated[1];
+      Vector<T,3> physPoint = param.hyperPlane->getPhysR(i[0], i[1]);
+      (*param.blockData)(evaluated,i);
+      foutCSV << physPoint[0] << " " << physPoint[1] << " " << physPoint[2] << " " << evaluated[0] << "\n";
+    }
+  }
+  foutCSV.close();
+}
+
+template <typename T>
+std::vector<std::uint8_t> generatePalette(const std::string& colour)
+{
+  std::vector<std::uint8_t> palette(3*256);
+  // Optional graphics::ColorMap for the schemes shared with BlockGifWriter
+  std::optional<graphics::ColorMap<double>> colorMap;
+  if (colour == "earth" || colour == "water" || colour == "air" || colour == "fire" || colour == "leeloo") {
+    colorMap = graphics::mapGenerators::generateMap<double>(colour);
+  }
+  for (int iColor=0; iColor < 256; ++iColor) {
+    const double x = iColor / 255.;
+    Vector<double,3> rgb;
+    if (colorMap) {
+      auto c = colorMap->get(x);
+      rgb = {c.r, c.g, c.b};
+    }
+    else if (colour == "grey") {
+      rgb = {x, x, x};
+    }
+    else if (colour == "pm3d") {
+      // gnuplot default, i.e. rgbformulae 7,5,15
+      rgb = {util::sqrt(x), x*x*x, util::max(0., util::sin(2*std::numbers::pi*x))};
+    }
+    else if (colour == "blackbody") {
+      rgb = x < 0.5 ? Vector<double,3>{2*x, 0, 0} : Vector<double,3>{1, 2*x-1, 0};
+    }
+    else {
+      // blue, green, yellow, orange, red as in the gnuplot palette definition
+      const Vector<double,3> stops[5] {{0,0,1}, {0,1,0}, {1,1,0}, {1,0.647,0}, {1,0,0}};
+      const int iStop = util::min(int(x*4), 3);
+      const double w = 4*x - iStop;
+      rgb = (1-w)*stops[iStop] + w*stops[iStop+1];
+    }
+    for (int iD=0; iD < 3; ++iD) {
+      palette[3*iColor+iD] = util::max(0., util::min(255., 255*rgb[iD] + 0.5));
+    }
+  }
+  return palette;
+}
+
+/// Pending background heat map outputs, flushed by waitForBackgroundOutput
+/**
+ * Not waited for on destruction as the thread pool may already be gone at that point
+ **/
+struct BackgroundOutputs {
+  std::mutex mutex;
+  std::vector<std::future<void>> futures;
+};
+
+inline BackgroundOutputs& backgroundOutputs()
+{
+  static BackgroundOutputs outputs;
+  return outputs;
+}
+
+template <typename T>
+void writeHeatMapPNG(detailParam<T>& param, const std::vector<T>& valueArea)
+{
+  const int iX0 = param.nx * param.zoomMin[0];
+  const int iY0 = param.ny * param.zoomMin[1];
+  const int nx = util::max(int(param.nx * param.zoomMax[0]) - iX0, 1);
+  const int ny = util::max(int(param.ny * param.zoomMax[1]) - iY0, 1);
+
+  // Evaluate synchronously, the reduced plane data may be updated afterwards
+  std::vector<double> values(nx*ny);
+  double minValue = std::numeric_limits<double>::max();
+  double maxValue = std::numeric_limits<double>::lowest();
+  int i[2] = {0,0};
+  for (int iY=0; iY < ny; ++iY) {
+    for (int iX=0; iX < nx; ++iX) {
+      T evaluated[1];
+      i[0] = iX0 + iX;
+      i[1] = iY0 + iY;
+      (*param.blockData)(evaluated,i);
+      values[iY*nx+iX] = BaseType<T>(evaluated[0]);
+      minValue = util::min(minValue, values[iY*nx+iX]);
+      maxValue = util::max(maxValue, values[iY*nx+iX]);
+    }
+  }
+  if (!valueArea.empty()) {
+    minValue = BaseType<T>(util::min(valueArea[0], valueArea[1]));
+    maxValue = BaseType<T>(util::max(valueArea[0], valueArea[1]));
+  }
+  else if (!util::nearZero(param.plot->maxValue - param.plot->minValue)) {
+    minValue = BaseType<T>(param.plot->minValue);
+    maxValue = BaseType<T>(param.plot->maxValue);
+  }
+
+  // Integer upscaling towards the canvas size of the gnuplot output
+  const int scale = util::max(1, util::min(param.canvasX / nx, param.canvasY / ny));
+  const bool colorBox = !param.plot->fullScreenPlot || param.plot->activateFullScreenPlotColorBox;
+  const std::string colour = param.plot->colour;
+  const std::string path = param.pngPath;
+
+  auto render = [values=std::move(values),nx,ny,minValue,maxValue,scale,colorBox,colour,path]() {
+    const std::vector<std::uint8_t> palette = generatePalette<T>(colour);
+    auto colorIndex = [&](double value) -> int {
+      if (maxValue <= minValue) {
+        return 0;
+      }
+      return util::max(0., util::min(255., 255 * (value - minValue) / (maxValue - minValue) + 0.5));
+    };
+
+    const int plotX = nx*scale;
+    const int plotY = ny*scale;
+    const int barWidth = colorBox ? util::max(4, plotX / 40) : 0;
+    const int width = colorBox ? plotX + 3*barWidth : plotX;
+    std::vector<std::uint8_t> rgb(3*width*plotY, 255);
+    for (int pY=0; pY < plotY; ++pY) {
+      // First image row is the top of the plane
+      const int iY = ny - 1 - pY / scale;
+      for (int pX=0; pX < plotX; ++pX) {
+        const int iColor = colorIndex(values[iY*nx + pX / scale]);
+        std::copy_n(palette.begin() + 3*iColor, 3, rgb.begin() + 3*(pY*width + pX));
+      }
+    }
+    if (colorBox) {
+      // Vertical colour bar covering the central 80% of the image height
+      const int barY0 = plotY / 10;
+      const int barY = util::max(1, plotY - 2*barY0);
+      for (int pY=barY0; pY < barY0 + barY; ++pY) {
+        const int iColor = util::max(0, util::min(255, 255 - (255 * (pY - barY0)) / barY));
+        for (int pX=plotX + barWidth; pX < plotX + 2*barWidth; ++pX) {
+          std::copy_n(palette.begin() + 3*iColor, 3, rgb.begin() + 3*(pY*width + pX));
+        }
+      }
+    }
+    writePNG(path, width, plotY, rgb);
+  };
+
+  if (param.plot->background) {
+    auto& outputs = backgroundOutputs();
+    std::scoped_lock lock(outputs.mutex);
+    std::erase_if(outputs.futures, [](auto& future) {
+      return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+    outputs.futures.emplace_back(singleton::pool().schedule(std::move(render)));
+  }
+  else {
+    render();
+  }
+}
+
 template <typename T>
 void writeHeatMapPlotFile(detailParam<T>& param, const std::vector<T>& valueArea)
 {
@@ -303,6 +467,16 @@ bool gnuplotInstalled()
 
 } // namespace detail
 
+inline void waitForBackgroundOutput()
+{
+  auto& outputs = detail::backgroundOutputs();
+  std::scoped_lock lock(outputs.mutex);
+  for (auto& future : outputs.futures) {
+    future.wait();
+  }
+  outputs.futures.clear();
+}
+
 } // namespace heatmap
 
 } // namespace olb
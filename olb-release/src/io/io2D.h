@@ -33,6 +33,7 @@
 #include "fileName.h"
 #include "gnuplotHeatMapWriter.h"
 #include "gnuplotWriter.h"
+#include "pngWriter.h"
 #include "ostreamManager.h"
 #include "parallelIO.h"
 #include "serializerIO.h"
@@ -31,6 +31,7 @@
 #include "fileName.hh"
 #include "gnuplotHeatMapWriter.hh"
 #include "gnuplotWriter.hh"
+#include "pngWriter.hh"
 #include "serializerIO.hh"
 #include "superVtmWriter2D.hh"
 #include "vtiReader.hh"
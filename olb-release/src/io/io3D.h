@@ -32,12 +32,14 @@
 #include "fileName.h"
 #include "gnuplotHeatMapWriter.h"
 #include "gnuplotWriter.h"
+#include "pngWriter.h"
 #include "ostreamManager.h"
 #include "parallelIO.h"
 #include "serializerIO.h"
 #include "stlReader.h"
 #include "superVtmWriter3D.h"
 #include "vtiReader.h"
+#include "volumeReader.h"
 #include "vtiWriter.h"
 #include "xmlReader.h"
 #include "cliReader.h"
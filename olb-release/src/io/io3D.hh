@@ -31,10 +31,12 @@
 #include "fileName.hh"
 #include "gnuplotHeatMapWriter.hh"
 #include "gnuplotWriter.hh"
+#include "pngWriter.hh"
 #include "serializerIO.hh"
 #include "stlReader.hh"
 #include "superVtmWriter3D.hh"
 #include "vtiReader.hh"
+#include "volumeReader.hh"
 #include "vtiWriter.hh"
 #include "octree.hh"
 #include "vtkWriter.hh"
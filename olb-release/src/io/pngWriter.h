@@ -0,0 +1,44 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+
+#ifndef PNG_WRITER_H
+#define PNG_WRITER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace olb {
+
+/// Writes 8 bit RGB image data as PNG file
+/**
+ * Rows are expected top to bottom, i.e. rgb[3*(iY*nx+iX)+{0,1,2}].
+ * Encoding uses zlib directly from memory, no external tools required.
+ **/
+inline void writePNG(const std::string& fileName, std::size_t nx, std::size_t ny,
+                     const std::vector<std::uint8_t>& rgb);
+
+}
+
+#endif
@@ -0,0 +1,99 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+
+#ifndef PNG_WRITER_HH
+#define PNG_WRITER_HH
+
+#include <fstream>
+#include <stdexcept>
+
+#include <zlib.h>
+
+#include "pngWriter.h"
+
+namespace olb {
+
+namespace detail {
+
+inline void appendBigEndian(std::vector<std::uint8_t>& buffer, std::uint32_t value)
+{
+  buffer.push_back((value >> 24) & 0xff);
+  buffer.push_back((value >> 16) & 0xff);
+  buffer.push_back((value >>  8) & 0xff);
+  buffer.push_back( value        & 0xff);
+}
+
+/// Appends PNG chunk consisting of length, type, data and CRC of type and data
+inline void appendPNGChunk(std::vector<std::uint8_t>& buffer, const char type[4],
+                           const std::uint8_t* data, std::size_t size)
+{
+  appendBigEndian(buffer, size);
+  const std::size_t iType = buffer.size();
+  buffer.insert(buffer.end(), type, type+4);
+  buffer.insert(buffer.end(), data, data+size);
+  appendBigEndian(buffer, crc32(0, buffer.data() + iType, size + 4));
+}
+
+}
+
+inline void writePNG(const std::string& fileName, std::size_t nx, std::size_t ny,
+                     const std::vector<std::uint8_t>& rgb)
+{
+  if (rgb.size() != 3*nx*ny) {
+    throw std::invalid_argument("RGB data does not match image dimensions");
+  }
+
+  // Each scanline is prefixed by its filter type (0: none)
+  std::vector<std::uint8_t> raw((3*nx+1)*ny);
+  for (std::size_t iY=0; iY < ny; ++iY) {
+    raw[iY*(3*nx+1)] = 0;
+    std::copy(rgb.begin() + 3*nx*iY, rgb.begin() + 3*nx*(iY+1),
+              raw.begin() + iY*(3*nx+1) + 1);
+  }
+
+  uLongf compressedSize = compressBound(raw.size());
+  std::vector<std::uint8_t> compressed(compressedSize);
+  if (compress2(compressed.data(), &compressedSize, raw.data(), raw.size(), Z_BEST_SPEED) != Z_OK) {
+    throw std::runtime_error("Compression of PNG data failed");
+  }
+
+  std::vector<std::uint8_t> png{0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+  png.reserve(compressedSize + 64);
+
+  std::vector<std::uint8_t> header;
+  detail::appendBigEndian(header, nx);
+  detail::appendBigEndian(header, ny);
+  // bit depth 8, truecolor, deflate, adaptive filtering, no interlace
+  header.insert(header.end(), {8, 2, 0, 0, 0});
+  detail::appendPNGChunk(png, "IHDR", header.data(), header.size());
+  detail::appendPNGChunk(png, "IDAT", compressed.data(), compressedSize);
+  detail::appendPNGChunk(png, "IEND", nullptr, 0);
+
+  std::ofstream fout(fileName, std::ios::binary | std::ios::trunc);
+  fout.write(reinterpret_cast<const char*>(png.data()), png.size());
+}
+
+}
+
+#endif
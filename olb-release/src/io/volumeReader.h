@@ -0,0 +1,222 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+/** \file
+ * Distributed reading of scalar voxel volumes (e.g. micro-CT samples).
+ *
+ * In contrast to BlockVTIreader3D the volume is never loaded as a whole.
+ * Only the file header is parsed, voxels are read directly from the file
+ * for the hyperslabs intersecting the cuboids of the local process.
+ *
+ * Supported are uncompressed volumes with a single scalar component:
+ *
+ * 1. VTI files with raw appended data (ParaView: "Data Mode" = "Appended",
+ *    "Encode Appended Data" disabled, no compression)
+ * 2. NumPy .npy files of shape (nz,ny,nx) in C order resp. (nx,ny,nz) in
+ *    Fortran order
+ * 3. Plain raw files described by a manually constructed volume::Layout
+ *
+ * Usage:
+ *
+ *   IndicatorVolume3D<T> rock(volume::readVTILayout<T>("rock.vti", "Tiff Scalars"));
+ *   IndicatorCuboid3D<T> bounds(rock.getMax() - rock.getMin(), rock.getMin());
+ *   CuboidDecomposition3D<T> cuboidDecomposition(bounds, deltaX, noOfCuboids);
+ *   HeuristicLoadBalancer<T> loadBalancer(cuboidDecomposition);
+ *   rock.load(cuboidDecomposition, loadBalancer);
+ *   superGeometry.rename(0, 2, rock);
+ */
+
+#ifndef VOLUME_READER_H
+#define VOLUME_READER_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <map>
+#include <stdexcept>
+
+#include "core/vector.h"
+#include "geometry/cuboidDecomposition.h"
+#include "communication/loadBalancer.h"
+#include "functors/analytical/indicator/indicatorF3D.h"
+#include "io/ostreamManager.h"
+
+namespace olb {
+
+namespace volume {
+
+/// Scalar types of voxel data
+enum struct ScalarType {
+  Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64, Float32, Float64
+};
+
+/// Returns size of scalar type in bytes
+inline std::size_t getSize(ScalarType type)
+{
+  switch (type) {
+  case ScalarType::Int8:
+  case ScalarType::UInt8:
+    return 1;
+  case ScalarType::Int16:
+  case ScalarType::UInt16:
+    return 2;
+  case ScalarType::Int32:
+  case ScalarType::UInt32:
+  case ScalarType::Float32:
+    return 4;
+  case ScalarType::Int64:
+  case ScalarType::UInt64:
+  case ScalarType::Float64:
+    return 8;
+  default:
+    throw std::invalid_argument("Invalid volume scalar type");
+  }
+}
+
+/// Returns scalar type of VTK type name (e.g. "UInt8")
+inline ScalarType getScalarTypeFromVTK(const std::string& name)
+{
+  static const std::map<std::string,ScalarType> types {
+    {"Int8",    ScalarType::Int8},    {"UInt8",   ScalarType::UInt8},
+    {"Int16",   ScalarType::Int16},   {"UInt16",  ScalarType::UInt16},
+    {"Int32",   ScalarType::Int32},   {"UInt32",  ScalarType::UInt32},
+    {"Int64",   ScalarType::Int64},   {"UInt64",  ScalarType::UInt64},
+    {"Float32", ScalarType::Float32}, {"Float64", ScalarType::Float64}
+  };
+  if (auto type = types.find(name); type != types.end()) {
+    return type->second;
+  }
+  throw std::invalid_argument("Unsupported VTK scalar type: " + name);
+}
+
+/// Layout of an uncompressed scalar voxel volume in a file
+/**
+ * Voxels are stored contiguously starting at offset, x-index fastest.
+ * Voxel (0,0,0) is centered at origin.
+ **/
+template <typename T>
+struct Layout {
+  std::string fileName;
+  /// Offset of the first voxel in bytes
+  std::size_t offset;
+  /// Number of voxels in each direction
+  Vector<int,3> extent;
+  Vector<T,3> origin;
+  /// Edge length of voxels
+  T deltaR;
+  ScalarType type;
+  /// True iff the byte order differs from the host
+  bool swapBytes;
+};
+
+/// Parses the header of a VTI file with raw appended data
+/**
+ * Only the XML header preceding the appended data is read.
+ **/
+template <typename T>
+Layout<T> readVTILayout(const std::string& fileName, const std::string& arrayName);
+
+/// Parses the header of a NumPy .npy file
+template <typename T>
+Layout<T> readNPYLayout(const std::string& fileName,
+                        Vector<T,3> origin = Vector<T,3>(0), T deltaR = 1);
+
+}
+
+/// Reads hyperslabs of a scalar voxel volume directly from its file
+template <typename T>
+class VolumeReader3D {
+private:
+  const volume::Layout<T> _layout;
+  /// File descriptor used for positional reads
+  int _file;
+
+  /// Reads count voxels starting at voxel index iVoxel and converts them to T
+  void readRun(std::size_t iVoxel, std::size_t count, T* data) const;
+
+public:
+  VolumeReader3D(volume::Layout<T> layout);
+  ~VolumeReader3D();
+
+  VolumeReader3D(const VolumeReader3D&) = delete;
+  VolumeReader3D& operator=(const VolumeReader3D&) = delete;
+
+  const volume::Layout<T>& getLayout() const {
+    return _layout;
+  }
+
+  /// Reads voxels of [min,max] (inclusive), x-index fastest
+  /**
+   * Each z-slice is read by a single pread if the hyperslab spans at least
+   * half of the volume in x-direction, row by row otherwise.
+   **/
+  void read(LatticeR<3> min, LatticeR<3> max, std::vector<T>& data) const;
+};
+
+/// Indicator of voxels fulfilling a threshold functor
+/**
+ * Only the hyperslabs covering the local cuboids of the given decomposition
+ * are kept in memory (one bit per voxel) after calling load. Evaluation
+ * outside of them (resp. before load) yields false.
+ *
+ * Bounds are available without loading any voxel data, i.e. the cuboid
+ * decomposition is to be constructed from the bounds instead of the
+ * indicator itself (which would shrink all cuboids to nothing).
+ **/
+template <typename T>
+class IndicatorVolume3D : public IndicatorF3D<T> {
+private:
+  const volume::Layout<T> _layout;
+  std::function<bool(T)> _threshold;
+
+  struct Slab {
+    LatticeR<3> min;
+    LatticeR<3> max;
+    std::vector<bool> inside;
+  };
+  std::vector<Slab> _slabs;
+
+  mutable OstreamManager clout;
+
+public:
+  /// Default threshold mirrors IndicatorBlockData3D, i.e. positive values are inside
+  IndicatorVolume3D(volume::Layout<T> layout,
+                    std::function<bool(T)> threshold = [](T value) {
+                      return value > std::numeric_limits<T>::epsilon();
+                    });
+
+  /// Loads voxels intersecting the local cuboids extended by margin
+  /**
+   * Default margin covers the geometry overlap of three cells plus one
+   * cell for e.g. IndicatorLayer3D.
+   **/
+  void load(CuboidDecomposition<T,3>& cuboidDecomposition,
+            LoadBalancer<T>& loadBalancer,
+            T margin = -1);
+
+  bool operator() (bool output[], const T input[]) override;
+};
+
+}
+
+#endif
@@ -0,0 +1,393 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef VOLUME_READER_HH
+#define VOLUME_READER_HH
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "tinyxml2.h"
+
+#include "volumeReader.h"
+
+namespace olb {
+
+namespace volume {
+
+template <typename T>
+Layout<T> readVTILayout(const std::string& fileName, const std::string& arrayName)
+{
+  std::ifstream file(fileName, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("Failed to open " + fileName);
+  }
+
+  // Read header up to the start of the appended data marked by '_'
+  std::string header;
+  std::size_t appendedBegin = std::string::npos;
+  std::size_t dataBegin = std::string::npos;
+  std::vector<char> chunk(1 << 16);
+  while (dataBegin == std::string::npos && file) {
+    file.read(chunk.data(), chunk.size());
+    header.append(chunk.data(), file.gcount());
+    if (appendedBegin == std::string::npos) {
+      appendedBegin = header.find("<AppendedData");
+    }
+    if (appendedBegin != std::string::npos) {
+      dataBegin = header.find('_', header.find('>', appendedBegin));
+    }
+  }
+  if (dataBegin == std::string::npos) {
+    throw std::runtime_error(fileName + " contains no appended data");
+  }
+  const std::string appendedTag = header.substr(appendedBegin, header.find('>', appendedBegin) - appendedBegin);
+  if (appendedTag.find("\"raw\"") == std::string::npos) {
+    throw std::runtime_error(fileName + ": only raw encoded appended data is supported");
+  }
+  header.resize(appendedBegin);
+  header += "</VTKFile>";
+
+  tinyxml2::XMLDocument document;
+  if (document.Parse(header.c_str()) != tinyxml2::XML_SUCCESS) {
+    throw std::runtime_error("Failed to parse header of " + fileName);
+  }
+  auto* vtkFile = document.FirstChildElement("VTKFile");
+  auto* imageData = vtkFile ? vtkFile->FirstChildElement("ImageData") : nullptr;
+  auto* piece = imageData ? imageData->FirstChildElement("Piece") : nullptr;
+  if (!piece) {
+    throw std::runtime_error(fileName + " is not a VTI file");
+  }
+  if (vtkFile->Attribute("compressor")) {
+    throw std::runtime_error(fileName + ": compressed data is not supported");
+  }
+
+  const tinyxml2::XMLElement* dataArray = nullptr;
+  bool isCellData = false;
+  for (const char* dataType : {"PointData", "CellData"}) {
+    if (auto* data = piece->FirstChildElement(dataType)) {
+      for (auto* array = data->FirstChildElement("DataArray"); array; array = array->NextSiblingElement("DataArray")) {
+        if (array->Attribute("Name", arrayName.c_str())) {
+          dataArray = array;
+          isCellData = std::string(dataType) == "CellData";
+        }
+      }
+    }
+  }
+  if (!dataArray) {
+    throw std::runtime_error(fileName + " contains no array " + arrayName);
+  }
+  if (!dataArray->Attribute("format", "appended")) {
+    throw std::runtime_error(fileName + ": array " + arrayName + " is not appended");
+  }
+  if (dataArray->IntAttribute("NumberOfComponents", 1) != 1) {
+    throw std::runtime_error(fileName + ": array " + arrayName + " is not scalar");
+  }
+
+  Layout<T> layout;
+  layout.fileName = fileName;
+  layout.type = getScalarTypeFromVTK(dataArray->Attribute("type"));
+
+  const bool isBigEndian = vtkFile->Attribute("byte_order", "BigEndian");
+  layout.swapBytes = isBigEndian != (std::endian::native == std::endian::big);
+
+  // Size prefix of appended blocks
+  const std::size_t headerSize = vtkFile->Attribute("header_type", "UInt64") ? 8 : 4;
+  layout.offset = dataBegin + 1 + dataArray->Unsigned64Attribute("offset") + headerSize;
+
+  std::istringstream wholeExtent(imageData->Attribute("WholeExtent"));
+  std::istringstream origin(imageData->Attribute("Origin"));
+  std::istringstream spacing(imageData->Attribute("Spacing"));
+  for (unsigned iD=0; iD < 3; ++iD) {
+    int min{}, max{};
+    wholeExtent >> min >> max;
+    layout.extent[iD] = max - min + (isCellData ? 0 : 1);
+    origin >> layout.origin[iD];
+  }
+  spacing >> layout.deltaR;
+  if (isCellData) {
+    for (unsigned iD=0; iD < 3; ++iD) {
+      layout.origin[iD] += T{0.5} * layout.deltaR;
+    }
+  }
+  return layout;
+}
+
+template <typename T>
+Layout<T> readNPYLayout(const std::string& fileName, Vector<T,3> origin, T deltaR)
+{
+  std::ifstream file(fileName, std::ios::binary);
+  char magic[8] { };
+  file.read(magic, 8);
+  if (!file || std::memcmp(magic, "\x93NUMPY", 6) != 0) {
+    throw std::runtime_error(fileName + " is not a NumPy file");
+  }
+  // Header length is stored as little endian uint16 (version 1) resp. uint32
+  unsigned char length[4] { };
+  const std::size_t lengthSize = magic[6] == 1 ? 2 : 4;
+  file.read(reinterpret_cast<char*>(length), lengthSize);
+  std::size_t headerSize = 0;
+  for (std::size_t i=0; i < lengthSize; ++i) {
+    headerSize |= std::size_t(length[i]) << (8*i);
+  }
+  std::string header(headerSize, ' ');
+  file.read(header.data(), headerSize);
+  if (!file) {
+    throw std::runtime_error("Failed to read header of " + fileName);
+  }
+
+  // Header is a Python dict literal, e.g. {'descr': '<f4', 'fortran_order': False, 'shape': (3, 4, 5), }
+  auto valueOf = [&](const std::string& key) -> std::string {
+    auto begin = header.find("'" + key + "'");
+    if (begin == std::string::npos) {
+      throw std::runtime_error(fileName + ": missing " + key);
+    }
+    begin = header.find_first_not_of(' ', header.find(':', begin) + 1);
+    const auto end = header[begin] == '(' ? header.find(')', begin) + 1
+                                          : header.find_first_of(",}", begin);
+    return header.substr(begin, end - begin);
+  };
+
+  Layout<T> layout;
+  layout.fileName = fileName;
+  layout.offset = 8 + lengthSize + headerSize;
+  layout.origin = origin;
+  layout.deltaR = deltaR;
+
+  const std::string descr = valueOf("descr");
+  const auto quote = descr.find('\'');
+  const char byteOrder = descr[quote+1];
+  const char kind = descr[quote+2];
+  const int size = std::stoi(descr.substr(quote+3));
+  layout.swapBytes = (byteOrder == '>' && std::endian::native == std::endian::little)
+                   || (byteOrder == '<' && std::endian::native == std::endian::big);
+  switch (kind) {
+  case 'b':
+  case 'u':
+    layout.type = size == 1 ? ScalarType::UInt8  : size == 2 ? ScalarType::UInt16
+                : size == 4 ? ScalarType::UInt32 : ScalarType::UInt64;
+    break;
+  case 'i':
+    layout.type = size == 1 ? ScalarType::Int8   : size == 2 ? ScalarType::Int16
+                : size == 4 ? ScalarType::Int32  : ScalarType::Int64;
+    break;
+  case 'f':
+    if (size != 4 && size != 8) {
+      throw std::runtime_error(fileName + ": unsupported type " + descr);
+    }
+    layout.type = size == 4 ? ScalarType::Float32 : ScalarType::Float64;
+    break;
+  default:
+    throw std::runtime_error(fileName + ": unsupported type " + descr);
+  }
+
+  std::string shape = valueOf("shape");
+  std::replace_if(shape.begin(), shape.end(), [](char c) { return c == '(' || c == ')' || c == ','; }, ' ');
+  std::istringstream dimensions(shape);
+  Vector<int,3> extent;
+  for (unsigned iD=0; iD < 3; ++iD) {
+    if (!(dimensions >> extent[iD])) {
+      throw std::runtime_error(fileName + ": volume must be three-dimensional");
+    }
+  }
+  // x-index is always fastest, i.e. C order corresponds to a shape of (nz,ny,nx)
+  const bool fortranOrder = valueOf("fortran_order").find("True") != std::string::npos;
+  layout.extent = fortranOrder ? extent : Vector<int,3>(extent[2], extent[1], extent[0]);
+  return layout;
+}
+
+}
+
+template <typename T>
+VolumeReader3D<T>::VolumeReader3D(volume::Layout<T> layout):
+  _layout(layout),
+  _file(::open(layout.fileName.c_str(), O_RDONLY))
+{
+  if (_file < 0) {
+    throw std::runtime_error("Failed to open " + layout.fileName);
+  }
+}
+
+template <typename T>
+VolumeReader3D<T>::~VolumeReader3D()
+{
+  ::close(_file);
+}
+
+template <typename T>
+void VolumeReader3D<T>::readRun(std::size_t iVoxel, std::size_t count, T* data) const
+{
+  const std::size_t size = volume::getSize(_layout.type);
+  std::vector<char> buffer(count * size);
+  std::size_t nRead = 0;
+  while (nRead < buffer.size()) {
+    const auto n = ::pread(_file, buffer.data() + nRead, buffer.size() - nRead,
+                           _layout.offset + iVoxel * size + nRead);
+    if (n <= 0) {
+      throw std::runtime_error("Failed to read voxels from " + _layout.fileName);
+    }
+    nRead += n;
+  }
+
+  if (_layout.swapBytes) {
+    for (std::size_t i=0; i < count; ++i) {
+      std::reverse(buffer.data() + i*size, buffer.data() + (i+1)*size);
+    }
+  }
+
+  auto convert = [&]<typename U>(meta::id<U>) {
+    for (std::size_t i=0; i < count; ++i) {
+      U value;
+      std::memcpy(&value, buffer.data() + i*size, size);
+      data[i] = static_cast<T>(value);
+    }
+  };
+  switch (_layout.type) {
+  case volume::ScalarType::Int8:    convert(meta::id<std::int8_t>{});   break;
+  case volume::ScalarType::UInt8:   convert(meta::id<std::uint8_t>{});  break;
+  case volume::ScalarType::Int16:   convert(meta::id<std::int16_t>{});  break;
+  case volume::ScalarType::UInt16:  convert(meta::id<std::uint16_t>{}); break;
+  case volume::ScalarType::Int32:   convert(meta::id<std::int32_t>{});  break;
+  case volume::ScalarType::UInt32:  convert(meta::id<std::uint32_t>{}); break;
+  case volume::ScalarType::Int64:   convert(meta::id<std::int64_t>{});  break;
+  case volume::ScalarType::UInt64:  convert(meta::id<std::uint64_t>{}); break;
+  case volume::ScalarType::Float32: convert(meta::id<float>{});         break;
+  case volume::ScalarType::Float64: convert(meta::id<double>{});        break;
+  }
+}
+
+template <typename T>
+void VolumeReader3D<T>::read(LatticeR<3> min, LatticeR<3> max, std::vector<T>& data) const
+{
+  const auto& extent = _layout.extent;
+  const std::size_t nX = max[0] - min[0] + 1;
+  const std::size_t nY = max[1] - min[1] + 1;
+  const std::size_t nZ = max[2] - min[2] + 1;
+  data.resize(nX * nY * nZ);
+
+  auto voxelIndex = [&](std::size_t iX, std::size_t iY, std::size_t iZ) -> std::size_t {
+    return (iZ * extent[1] + iY) * extent[0] + iX;
+  };
+
+  std::vector<T> slice;
+  for (std::size_t iZ=0; iZ < nZ; ++iZ) {
+    T* target = data.data() + iZ * nX * nY;
+    if (2 * nX >= std::size_t(extent[0])) {
+      // Read contiguous span of the slice and discard voxels outside of [min,max]
+      const std::size_t begin = voxelIndex(min[0], min[1], min[2] + iZ);
+      slice.resize(voxelIndex(max[0], max[1], min[2] + iZ) - begin + 1);
+      readRun(begin, slice.size(), slice.data());
+      for (std::size_t iY=0; iY < nY; ++iY) {
+        std::copy_n(slice.data() + iY * extent[0], nX, target + iY * nX);
+      }
+    } else {
+      for (std::size_t iY=0; iY < nY; ++iY) {
+        readRun(voxelIndex(min[0], min[1] + iY, min[2] + iZ), nX, target + iY * nX);
+      }
+    }
+  }
+}
+
+template <typename T>
+IndicatorVolume3D<T>::IndicatorVolume3D(volume::Layout<T> layout,
+                                        std::function<bool(T)> threshold):
+  _layout(layout),
+  _threshold(threshold),
+  clout(std::cout, "IndicatorVolume3D")
+{
+  for (unsigned iD=0; iD < 3; ++iD) {
+    this->_myMin[iD] = _layout.origin[iD] - T{0.5} * _layout.deltaR;
+    this->_myMax[iD] = _layout.origin[iD] + (_layout.extent[iD] - T{0.5}) * _layout.deltaR;
+  }
+}
+
+template <typename T>
+void IndicatorVolume3D<T>::load(CuboidDecomposition<T,3>& cuboidDecomposition,
+                                LoadBalancer<T>& loadBalancer,
+                                T margin)
+{
+  VolumeReader3D<T> reader(_layout);
+
+  _slabs.clear();
+  std::size_t nLoaded = 0;
+  std::vector<T> data;
+  for (int iC=0; iC < loadBalancer.size(); ++iC) {
+    auto& cuboid = cuboidDecomposition.get(loadBalancer.glob(iC));
+    const T cuboidMargin = margin < 0 ? 4 * cuboid.getDeltaR() : margin;
+    Slab slab;
+    bool isEmpty = false;
+    for (unsigned iD=0; iD < 3; ++iD) {
+      const T min = cuboid.getOrigin()[iD] - cuboidMargin;
+      const T max = cuboid.getOrigin()[iD] + (cuboid.getExtent()[iD]-1) * cuboid.getDeltaR() + cuboidMargin;
+      slab.min[iD] = std::max(0, int(util::floor((min - _layout.origin[iD]) / _layout.deltaR + T{0.5})));
+      slab.max[iD] = std::min(_layout.extent[iD]-1, int(util::floor((max - _layout.origin[iD]) / _layout.deltaR + T{0.5})));
+      isEmpty |= slab.min[iD] > slab.max[iD];
+    }
+    if (isEmpty) {
+      continue;
+    }
+    reader.read(slab.min, slab.max, data);
+    slab.inside.resize(data.size());
+    for (std::size_t i=0; i < data.size(); ++i) {
+      slab.inside[i] = _threshold(data[i]);
+    }
+    nLoaded += data.size();
+    _slabs.emplace_back(std::move(slab));
+  }
+
+  std::size_t nTotal = std::size_t(_layout.extent[0]) * _layout.extent[1] * _layout.extent[2];
+#ifdef PARALLEL_MODE_MPI
+  singleton::mpi().reduceAndBcast(nLoaded, MPI_SUM);
+#endif
+  clout << "Loaded " << nLoaded << " of " << nTotal << " voxels from " << _layout.fileName << std::endl;
+}
+
+template <typename T>
+bool IndicatorVolume3D<T>::operator()(bool output[], const T input[])
+{
+  LatticeR<3> voxel;
+  for (unsigned iD=0; iD < 3; ++iD) {
+    voxel[iD] = util::floor((input[iD] - _layout.origin[iD]) / _layout.deltaR + T{0.5});
+  }
+  output[0] = false;
+  for (const Slab& slab : _slabs) {
+    if (slab.min <= voxel && voxel <= slab.max) {
+      const LatticeR<3> local = voxel - slab.min;
+      const std::size_t nX = slab.max[0] - slab.min[0] + 1;
+      const std::size_t nY = slab.max[1] - slab.min[1] + 1;
+      output[0] = slab.inside[(local[2] * nY + local[1]) * nX + local[0]];
+      break;
+    }
+  }
+  return output[0];
+}
+
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include <functional>
 
 #include "io/xmlReader.h"
+#include "communication/mpiManager.h"
 
 namespace olb {
 
@@ -120,6 +121,58 @@ protected:
   bool                                  _objectiveComputed {false};
   S                                     _objective;
 
+  /// Number of process groups evaluating perturbed controls concurrently
+  int                                   _nGroups {1};
+  /// Store / restore state of the unperturbed evaluation (warm start)
+  std::function<void (void)>            _storeState     { [](){} };
+  std::function<void (void)>            _restoreState   { [](){} };
+  bool                                  _warmStart {false};
+
+  /// Evaluate objective for all controls
+  /**
+   * If parallel evaluation is enabled, the controls are distributed cyclically
+   * over disjoint process groups. Each evaluation is executed with the group
+   * communicator active, i.e. simulations are set up over the group's processes.
+   **/
+  std::vector<S> evaluateObjectives(const std::vector<C>& controls, unsigned optiStep)
+  {
+    std::vector<S> objectives(controls.size(), S{});
+#ifdef PARALLEL_MODE_MPI
+    if constexpr (std::is_floating_point_v<S>) {
+      const int size = singleton::mpi().getSize();
+      if (_nGroups > 1 && size > 1) {
+        const int rank    = singleton::mpi().getRank();
+        const int nGroups = util::min(_nGroups, size);
+        const int iGroup  = (static_cast<long>(rank) * nGroups) / size;
+
+        MPI_Comm parentComm = singleton::mpi().getCommunicator();
+        MPI_Comm groupComm;
+        MPI_Comm_split(parentComm, iGroup, rank, &groupComm);
+
+        singleton::mpi().setCommunicator(groupComm);
+        for (std::size_t i = iGroup; i < controls.size(); i += nGroups) {
+          _restoreState();
+          const S objective = _function(controls[i], optiStep);
+          if (singleton::mpi().isMainProcessor()) {
+            objectives[i] = objective;
+          }
+        }
+        singleton::mpi().setCommunicator(parentComm);
+        MPI_Comm_free(&groupComm);
+
+        // Every objective is contributed by exactly one process
+        singleton::mpi().allReduceVect(objectives, MPI_SUM, parentComm);
+        return objectives;
+      }
+    }
+#endif
+    for (std::size_t i = 0; i < controls.size(); ++i) {
+      _restoreState();
+      objectives[i] = _function(controls[i], optiStep);
+    }
+    return objectives;
+  }
+
 public:
   explicit OptiCaseDQ(std::function<S (const C&, unsigned)> function,
     std::function<void (void)> postEvaluation)
@@ -147,6 +200,27 @@ public:
     _objectiveComputed = true;
     return _objective;
   }
+
+  /// Evaluate the perturbed controls concurrently on nGroups groups of processes
+  /**
+   * The gradient passed to the optimizer is identical to the sequential evaluation.
+   **/
+  void setParallelEvaluation(int nGroups) {
+    _nGroups = nGroups;
+  }
+
+  /// Start each perturbed evaluation from the state of the unperturbed one
+  /**
+   * storeState is called after the evaluation of the unperturbed control,
+   * restoreState prior to each evaluation of a perturbed control (with the
+   * communicator of the evaluating process group active).
+   **/
+  void setWarmStart(std::function<void (void)> storeState,
+                    std::function<void (void)> restoreState) {
+    _storeState   = storeState;
+    _restoreState = restoreState;
+    _warmStart    = true;
+  }
 };
 
 
@@ -178,13 +252,18 @@ public:
       this->evaluateObjective(control, optiStep);
     }
     const S objective(this->_objective);
+    this->_storeState();
 
+    std::vector<C> shiftedControls(control.size(), control);
     for (std::size_t it = 0; it < control.size(); ++it)
     {
-      C shiftedControl(control);
-      shiftedControl[it] += this->_stepWidth;
-      S shiftedObjective = this->evaluateObjective(shiftedControl, optiStep);
-      derivatives[it] = (shiftedObjective - objective) / this->_stepWidth;
+      shiftedControls[it][it] += this->_stepWidth;
+    }
+    const std::vector<S> shiftedObjectives = this->evaluateObjectives(shiftedControls, optiStep);
+
+    for (std::size_t it = 0; it < control.size(); ++it)
+    {
+      derivatives[it] = (shiftedObjectives[it] - objective) / this->_stepWidth;
     }
     this->_objectiveComputed = false;
   }
@@ -246,15 +325,25 @@ public:
   {
     assert((control.size() == derivatives.size()));
 
+    // Warm start requires the state of the unperturbed control
+    if (this->_warmStart && !(this->_objectiveComputed)) {
+      this->evaluateObjective(control, optiStep);
+    }
+    this->_storeState();
+
+    // Perturbed controls ordered as (+0, -0, +1, -1, ...)
+    std::vector<C> shiftedControls(2*control.size(), control);
     for (std::size_t it = 0; it < control.size(); ++it)
     {
-      C shiftedControl(control);
-      shiftedControl[it] += this->_stepWidth;
-      S shiftedObjective_plus = this->evaluateObjective(shiftedControl, optiStep);
-
-      shiftedControl[it] = control[it] - this->_stepWidth;
-      S shiftedObjective_minus = this->evaluateObjective(shiftedControl, optiStep);
+      shiftedControls[2*it  ][it] += this->_stepWidth;
+      shiftedControls[2*it+1][it]  = control[it] - this->_stepWidth;
+    }
+    const std::vector<S> shiftedObjectives = this->evaluateObjectives(shiftedControls, optiStep);
 
+    for (std::size_t it = 0; it < control.size(); ++it)
+    {
+      const S shiftedObjective_plus  = shiftedObjectives[2*it];
+      const S shiftedObjective_minus = shiftedObjectives[2*it+1];
       derivatives[it] = 0.5 * (shiftedObjective_plus - shiftedObjective_minus) / this->_stepWidth;
     }
   }
@@ -33,23 +33,23 @@ namespace communication {
 ParticleCommunicator::ParticleCommunicator()
 {
 #ifdef PARALLEL_MODE_MPI
-  if (MPI_Comm_dup(MPI_COMM_WORLD, &particleDistribution) != MPI_SUCCESS) {
+  if (MPI_Comm_dup(singleton::mpi().getCommunicator(), &particleDistribution) != MPI_SUCCESS) {
     throw std::runtime_error("Unable to duplicate MPI communicator");
   }
-  if (MPI_Comm_dup(MPI_COMM_WORLD, &surfaceForceComm) != MPI_SUCCESS) {
+  if (MPI_Comm_dup(singleton::mpi().getCommunicator(), &surfaceForceComm) != MPI_SUCCESS) {
     throw std::runtime_error("Unable to duplicate MPI communicator");
   }
-  if (MPI_Comm_dup(MPI_COMM_WORLD, &wallContactDetectionComm) != MPI_SUCCESS) {
+  if (MPI_Comm_dup(singleton::mpi().getCommunicator(), &wallContactDetectionComm) != MPI_SUCCESS) {
     throw std::runtime_error("Unable to duplicate MPI communicator");
   }
-  if (MPI_Comm_dup(MPI_COMM_WORLD, &particleContactDetectionComm) !=
+  if (MPI_Comm_dup(singleton::mpi().getCommunicator(), &particleContactDetectionComm) !=
       MPI_SUCCESS) {
     throw std::runtime_error("Unable to duplicate MPI communicator");
   }
-  if (MPI_Comm_dup(MPI_COMM_WORLD, &contactTreatmentComm) != MPI_SUCCESS) {
+  if (MPI_Comm_dup(singleton::mpi().getCommunicator(), &contactTreatmentComm) != MPI_SUCCESS) {
     throw std::runtime_error("Unable to duplicate MPI communicator");
   }
-  if (MPI_Comm_dup(MPI_COMM_WORLD, &equationsOfMotionComm) != MPI_SUCCESS) {
+  if (MPI_Comm_dup(singleton::mpi().getCommunicator(), &equationsOfMotionComm) != MPI_SUCCESS) {
     throw std::runtime_error("Unable to duplicate MPI communicator");
   }
 #endif
@@ -738,7 +738,7 @@ template<typename DATA>
 void collectDataAndAppendVector( std::vector<DATA>& dataVector,
   std::set<int>& availableRanks,
   singleton::MpiNonBlockingHelper& mpiNbHelper,
-  MPI_Comm commGroup = MPI_COMM_WORLD)
+  MPI_Comm commGroup = singleton::mpi().getCommunicator())
 {
   DATA data;
   auto communicatable = ConcreteCommunicatable(data);
@@ -27,10 +27,29 @@
 #ifndef CONTACT_CONTAINER_H
 #define CONTACT_CONTAINER_H
 
+#include <unordered_map>
+
 namespace olb {
 namespace particles {
 namespace contact {
 
+/// Hash of an id pair (sorted particle ids or particle id and wall id)
+struct ContactIDsHash {
+  std::size_t operator()(const std::array<std::size_t, 2>& ids) const noexcept
+  {
+    // 64 bit mixing (splitmix) of both ids to avoid clustering of consecutive ids
+    std::uint64_t h = static_cast<std::uint64_t>(ids[0]) * 0x9E3779B97F4A7C15ull
+                    ^ (static_cast<std::uint64_t>(ids[1]) + 0x7F4A7C159E3779B9ull);
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+    return static_cast<std::size_t>(h ^ (h >> 31));
+  }
+};
+
+/// Maps id pairs to the index of the corresponding contact
+using ContactIndexMap = std::unordered_map<std::array<std::size_t, 2>, std::size_t,
+                                           ContactIDsHash>;
+
 template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
 struct ContactContainer {
 public:
@@ -60,6 +79,49 @@ public:
 
   ContactContainer<T, PARTICLECONTACTTYPE, WALLCONTACTTYPE>& operator=(
       ContactContainer<T, PARTICLECONTACTTYPE, WALLCONTACTTYPE>& container);
+
+  /// Find particle-particle contact by (unsorted) particle ids in O(1)
+  /** Returns std::end(particleContacts) if no such contact exists */
+  typename std::vector<PARTICLECONTACTTYPE>::iterator
+  findParticleContact(const std::array<std::size_t, 2>& ids);
+  /// Find particle-wall contact by particle and wall id in O(1)
+  /** Returns std::end(wallContacts) if no such contact exists */
+  typename std::vector<WALLCONTACTTYPE>::iterator
+  findWallContact(std::size_t particleID, unsigned wallID);
+
+  /// Append new particle-particle contact and register it in the lookup
+  PARTICLECONTACTTYPE& addParticleContact(const std::array<std::size_t, 2>& ids);
+  /// Append new particle-wall contact and register it in the lookup
+  WALLCONTACTTYPE& addWallContact(std::size_t particleID, unsigned wallID);
+
+  /// Rebuild id lookups of all contacts and drop the cached particle lookup
+  /** Should be called before each contact detection sweep, the contact lookups
+   *  detect a changed number of contacts on their own. */
+  void updateContactIndices();
+
+  /// Get local index of particle with given global id in particle system
+  /** Lookup is cached until the next detection sweep or until the particle
+   *  system changes in size, unknown ids are returned unchanged. */
+  template <typename PARTICLESYSTEM>
+  std::size_t getLocalParticleIndex(PARTICLESYSTEM& particleSystem,
+                                    std::size_t     globalParticleID);
+
+private:
+  void updateParticleContactIndex();
+  void updateWallContactIndex();
+
+  /// Sorted particle ids -> index in particleContacts
+  ContactIndexMap _particleContactIndex;
+  /// Particle id and wall id -> index in wallContacts
+  ContactIndexMap _wallContactIndex;
+  /// Number of contacts covered by the lookups
+  std::size_t _indexedParticleContacts = 0;
+  std::size_t _indexedWallContacts     = 0;
+
+  /// Global particle id -> local particle index
+  std::unordered_map<std::size_t, std::size_t> _localParticleIndex;
+  const void* _indexedParticleSystem = nullptr;
+  std::size_t _indexedParticles      = 0;
 };
 
 } // namespace contact
@@ -24,6 +24,9 @@
 #ifndef PARTICLE_CONTACT_CONTAINER_HH
 #define PARTICLE_CONTACT_CONTAINER_HH
 
+#include <algorithm>
+#include <numeric>
+
 #include "contactContainer.h"
 #include "contactFunctions.h"
 
@@ -43,20 +46,40 @@ template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
 void ContactContainer<T, PARTICLECONTACTTYPE,
                       WALLCONTACTTYPE>::combineContacts()
 {
-  for (auto it = std::begin(particleContacts); it != std::end(particleContacts);
-       ++it) {
-    for (auto it2 = it + 1; it2 != std::end(particleContacts); ++it2) {
-      // combineWith must check if the particle ids are the same
-      it->combineWith(*it2);
+  // Only contacts with the same ids are combined, so it suffices to visit
+  // all pairs within groups of equal ids (in their original order)
+  const auto combineGroups = [](auto& contacts, auto getKey) {
+    std::vector<std::size_t> order(contacts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t a, std::size_t b) {
+                       return getKey(contacts[a]) < getKey(contacts[b]);
+                     });
+    for (std::size_t begin = 0; begin < order.size();) {
+      std::size_t end = begin + 1;
+      while (end < order.size() &&
+             getKey(contacts[order[end]]) == getKey(contacts[order[begin]])) {
+        ++end;
+      }
+      for (std::size_t i = begin; i < end; ++i) {
+        for (std::size_t j = i + 1; j < end; ++j) {
+          // combineWith must check if the contacts are the same
+          contacts[order[i]].combineWith(contacts[order[j]]);
+        }
+      }
+      begin = end;
     }
-  }
+  };
 
-  for (auto it = std::begin(wallContacts); it != std::end(wallContacts); ++it) {
-    for (auto it2 = it + 1; it2 != std::end(wallContacts); ++it2) {
-      // combineWith must check if the contacts are the same
-      it->combineWith(*it2);
-    }
-  }
+  combineGroups(particleContacts, [](const PARTICLECONTACTTYPE& contact) {
+    return std::array<std::size_t, 2>(
+        {util::min(contact.getIDs()[0], contact.getIDs()[1]),
+         util::max(contact.getIDs()[0], contact.getIDs()[1])});
+  });
+  combineGroups(wallContacts, [](const WALLCONTACTTYPE& contact) {
+    return std::array<std::size_t, 2>(
+        {contact.getParticleID(), std::size_t(contact.getWallID())});
+  });
 }
 
 template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
@@ -64,6 +87,7 @@ void ContactContainer<T, PARTICLECONTACTTYPE,
                       WALLCONTACTTYPE>::cleanParticleContacts()
 {
   particles::contact::cleanContacts(particleContacts);
+  updateParticleContactIndex();
 }
 
 template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
@@ -71,6 +95,7 @@ void ContactContainer<T, PARTICLECONTACTTYPE,
                       WALLCONTACTTYPE>::cleanWallContacts()
 {
   particles::contact::cleanContacts(wallContacts);
+  updateWallContactIndex();
 }
 
 template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
@@ -78,6 +103,7 @@ void ContactContainer<T, PARTICLECONTACTTYPE, WALLCONTACTTYPE>::cleanContacts()
 {
   cleanParticleContacts();
   cleanWallContacts();
+  _indexedParticleSystem = nullptr;
 }
 
 template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
@@ -87,6 +113,7 @@ void ContactContainer<T, PARTICLECONTACTTYPE,
   const std::size_t capacity = particleContacts.capacity();
   particleContacts.clear();
   particleContacts.reserve(capacity / 2);
+  updateParticleContactIndex();
 }
 
 template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
@@ -96,6 +123,7 @@ void ContactContainer<T, PARTICLECONTACTTYPE,
   const std::size_t capacity = wallContacts.capacity();
   wallContacts.clear();
   wallContacts.reserve(capacity / 2);
+  updateWallContactIndex();
 }
 
 template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
@@ -122,9 +150,178 @@ ContactContainer<T, PARTICLECONTACTTYPE, WALLCONTACTTYPE>::operator=(
     wallContacts.push_back(container.wallContacts[i]);
   }
 
+  updateContactIndices();
   return *this;
 }
 
+template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
+void ContactContainer<T, PARTICLECONTACTTYPE,
+                      WALLCONTACTTYPE>::updateParticleContactIndex()
+{
+  _particleContactIndex.clear();
+  _particleContactIndex.reserve(particleContacts.size());
+  for (std::size_t i = 0; i < particleContacts.size(); ++i) {
+    const auto& ids = particleContacts[i].getIDs();
+    // Keep the first occurrence in case of not yet combined duplicates
+    _particleContactIndex.emplace(
+        std::array<std::size_t, 2>(
+            {util::min(ids[0], ids[1]), util::max(ids[0], ids[1])}),
+        i);
+  }
+  _indexedParticleContacts = particleContacts.size();
+}
+
+template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
+void ContactContainer<T, PARTICLECONTACTTYPE,
+                      WALLCONTACTTYPE>::updateWallContactIndex()
+{
+  _wallContactIndex.clear();
+  _wallContactIndex.reserve(wallContacts.size());
+  for (std::size_t i = 0; i < wallContacts.size(); ++i) {
+    _wallContactIndex.emplace(
+        std::array<std::size_t, 2>({wallContacts[i].getParticleID(),
+                                    std::size_t(wallContacts[i].getWallID())}),
+        i);
+  }
+  _indexedWallContacts = wallContacts.size();
+}
+
+template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
+void ContactContainer<T, PARTICLECONTACTTYPE,
+                      WALLCONTACTTYPE>::updateContactIndices()
+{
+  updateParticleContactIndex();
+  updateWallContactIndex();
+  _indexedParticleSystem = nullptr;
+}
+
+template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
+typename std::vector<PARTICLECONTACTTYPE>::iterator
+ContactContainer<T, PARTICLECONTACTTYPE, WALLCONTACTTYPE>::findParticleContact(
+    const std::array<std::size_t, 2>& ids)
+{
+  const std::array<std::size_t, 2> key(
+      {util::min(ids[0], ids[1]), util::max(ids[0], ids[1])});
+  // The vector may have been modified directly (e.g. during communication)
+  if (_indexedParticleContacts != particleContacts.size()) {
+    updateParticleContactIndex();
+  }
+  for (unsigned attempt = 0; attempt < 2; ++attempt) {
+    auto entry = _particleContactIndex.find(key);
+    if (entry == _particleContactIndex.end()) {
+      break;
+    }
+    if (entry->second < particleContacts.size()) {
+      const auto& contactIDs = particleContacts[entry->second].getIDs();
+      if (util::min(contactIDs[0], contactIDs[1]) == key[0] &&
+          util::max(contactIDs[0], contactIDs[1]) == key[1]) {
+        return std::begin(particleContacts) + entry->second;
+      }
+    }
+    // Stale entry, rebuild once and retry
+    updateParticleContactIndex();
+  }
+  return std::end(particleContacts);
+}
+
+template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
+typename std::vector<WALLCONTACTTYPE>::iterator
+ContactContainer<T, PARTICLECONTACTTYPE, WALLCONTACTTYPE>::findWallContact(
+    std::size_t particleID, unsigned wallID)
+{
+  const std::array<std::size_t, 2> key({particleID, std::size_t(wallID)});
+  if (_indexedWallContacts != wallContacts.size()) {
+    updateWallContactIndex();
+  }
+  for (unsigned attempt = 0; attempt < 2; ++attempt) {
+    auto entry = _wallContactIndex.find(key);
+    if (entry == _wallContactIndex.end()) {
+      break;
+    }
+    if (entry->second < wallContacts.size() &&
+        wallContacts[entry->second].getParticleID() == particleID &&
+        wallContacts[entry->second].getWallID() == wallID) {
+      return std::begin(wallContacts) + entry->second;
+    }
+    updateWallContactIndex();
+  }
+  return std::end(wallContacts);
+}
+
+template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
+PARTICLECONTACTTYPE&
+ContactContainer<T, PARTICLECONTACTTYPE, WALLCONTACTTYPE>::addParticleContact(
+    const std::array<std::size_t, 2>& ids)
+{
+  if (_indexedParticleContacts != particleContacts.size()) {
+    updateParticleContactIndex();
+  }
+  particleContacts.push_back(PARTICLECONTACTTYPE(ids));
+  _particleContactIndex.emplace(
+      std::array<std::size_t, 2>(
+          {util::min(ids[0], ids[1]), util::max(ids[0], ids[1])}),
+      particleContacts.size() - 1);
+  ++_indexedParticleContacts;
+  return particleContacts.back();
+}
+
+template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
+WALLCONTACTTYPE&
+ContactContainer<T, PARTICLECONTACTTYPE, WALLCONTACTTYPE>::addWallContact(
+    std::size_t particleID, unsigned wallID)
+{
+  if (_indexedWallContacts != wallContacts.size()) {
+    updateWallContactIndex();
+  }
+  wallContacts.push_back(WALLCONTACTTYPE(particleID, wallID));
+  _wallContactIndex.emplace(
+      std::array<std::size_t, 2>({particleID, std::size_t(wallID)}),
+      wallContacts.size() - 1);
+  ++_indexedWallContacts;
+  return wallContacts.back();
+}
+
+template <typename T, typename PARTICLECONTACTTYPE, typename WALLCONTACTTYPE>
+template <typename PARTICLESYSTEM>
+std::size_t
+ContactContainer<T, PARTICLECONTACTTYPE, WALLCONTACTTYPE>::getLocalParticleIndex(
+    PARTICLESYSTEM& particleSystem, std::size_t globalParticleID)
+{
+  using namespace descriptors;
+  const auto globalIDOf = [&](std::size_t localiP) -> std::size_t {
+    return particleSystem.get(localiP)
+        .template getField<PARALLELIZATION, ID>();
+  };
+  const auto updateIndex = [&]() {
+    _localParticleIndex.clear();
+    _localParticleIndex.reserve(particleSystem.size());
+    for (std::size_t localiP = 0; localiP < particleSystem.size(); ++localiP) {
+      _localParticleIndex.emplace(globalIDOf(localiP), localiP);
+    }
+    _indexedParticleSystem = &particleSystem;
+    _indexedParticles      = particleSystem.size();
+  };
+
+  if (_indexedParticleSystem != &particleSystem ||
+      _indexedParticles != particleSystem.size()) {
+    updateIndex();
+  }
+  for (unsigned attempt = 0; attempt < 2; ++attempt) {
+    auto entry = _localParticleIndex.find(globalParticleID);
+    if (entry == _localParticleIndex.end()) {
+      break;
+    }
+    if (entry->second < particleSystem.size() &&
+        globalIDOf(entry->second) == globalParticleID) {
+      return entry->second;
+    }
+    // Particles were reordered (e.g. by relocation)
+    updateIndex();
+  }
+  // Unknown ids are treated as local indices
+  return globalParticleID;
+}
+
 } // namespace contact
 } // namespace particles
 } // namespace olb
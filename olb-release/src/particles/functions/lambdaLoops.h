@@ -146,6 +146,51 @@ void forParticlesInParticleSystem(
   }
 }
 
+//Iterate over particles in particle system satisfying the provided particle condition
+//- particles are distributed among OpenMP threads (if enabled)
+//- f must only modify the particle it is called for
+template<typename T, typename PARTICLETYPE, typename PCONDITION=conditions::valid_particles, typename F>
+void forParticlesInParticleSystemParallel(
+  ParticleSystem<T,PARTICLETYPE>& particleSystem,
+  F f, int globiC )
+{
+  const std::size_t size = particleSystem.size();
+  #ifdef PARALLEL_MODE_OMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (std::size_t iP=0; iP<size; ++iP) {
+    auto particle = particleSystem.get(iP);
+    //Execute F when particle meets condition
+    doWhenMeetingCondition<T,PARTICLETYPE,PCONDITION>( particle,
+      [&](Particle<T,PARTICLETYPE> particle){
+      f( particle );
+    }, globiC );
+  }
+}
+
+//Iterate over particles in particle system satisfying the provided particle condition
+//- particles are distributed among OpenMP threads (if enabled)
+//- f must only modify the particle it is called for
+//- no globiC required
+template<typename T, typename PARTICLETYPE, typename PCONDITION=conditions::valid_particles, typename F>
+void forParticlesInParticleSystemParallel(
+  ParticleSystem<T,PARTICLETYPE>& particleSystem,
+  F f )
+{
+  const std::size_t size = particleSystem.size();
+  #ifdef PARALLEL_MODE_OMP
+  #pragma omp parallel for schedule(static)
+  #endif
+  for (std::size_t iP=0; iP<size; ++iP) {
+    auto particle = particleSystem.get(iP);
+    //Execute F when particle meets condition
+    doWhenMeetingCondition<T,PARTICLETYPE,PCONDITION>( particle,
+      [&](Particle<T,PARTICLETYPE> particle){
+      f( particle );
+    });
+  }
+}
+
 
 namespace communication {
 
@@ -191,6 +236,31 @@ void forParticlesInSuperParticleSystem(
   });
 }
 
+//Iterate over particles in super particle system
+//- particles of each block are distributed among OpenMP threads (if enabled)
+//- f must only modify the particle it is called for
+template<typename T, typename PARTICLETYPE, typename PCONDITION=conditions::valid_particles, typename F>
+void forParticlesInSuperParticleSystemParallel(
+  SuperParticleSystem<T,PARTICLETYPE>& sParticleSystem,
+  F f )
+{
+  //Iterate over particle systems
+  forSystemsInSuperParticleSystem( sParticleSystem,
+    [&](ParticleSystem<T,PARTICLETYPE>& particleSystem, int iC, int globiC){
+    //Iterate over particles concurrently
+    forParticlesInParticleSystemParallel<T,PARTICLETYPE,PCONDITION>( particleSystem,
+      [&](Particle<T,PARTICLETYPE>& particle){
+      if constexpr (std::is_invocable_v<F,
+        Particle<T,PARTICLETYPE>&,ParticleSystem<T,PARTICLETYPE>&,int>)
+      {
+        f( particle, particleSystem, globiC );
+      } else {
+        f( particle );
+      }
+    },globiC);
+  });
+}
+
 //Do for particle in superParticleSystem
 //- enables retrieval via particle locator, hence circumvents
 // having to search for a speficic particle again
@@ -261,14 +261,8 @@ void updateContacts(
     const PhysR<T, PARTICLETYPE::d>& cellMin,
     const PhysR<T, PARTICLETYPE::d>& cellMax, F getSetupPeriodicity, T deltaX)
 {
-  // find the contact by checking particle ids
-  const std::function<bool(const PARTICLECONTACTTYPE&)> condition =
-      [&ids](const PARTICLECONTACTTYPE& contact) {
-        // we assume that ids aren't sorted
-        return particleContactConsistsOfIDs(contact, ids);
-      };
-  auto contactIt =
-      getContactIterator(contactContainer.particleContacts, condition);
+  // find the contact by its (unsorted) particle ids using the hashed lookup
+  auto contactIt = contactContainer.findParticleContact(ids);
 
   if (contactIt != std::end(contactContainer.particleContacts)) {
     if (contactIt->isNew()) {
@@ -284,17 +278,15 @@ void updateContacts(
     }
   }
   else {
-    contactContainer.particleContacts.push_back(PARTICLECONTACTTYPE(ids));
-    if (particleContactConsistsOfIDs<PARTICLECONTACTTYPE, true>(
-            *(contactContainer.particleContacts.end() - 1), ids)) {
-      updateContact(*(contactContainer.particleContacts.end() - 1), particle1,
-                    particle2, pos, cellMin, cellMax, getSetupPeriodicity,
-                    deltaX);
+    auto& contact = contactContainer.addParticleContact(ids);
+    // the contact stores the ids sorted, i.e. the particles may need to be swapped
+    if (particleContactConsistsOfIDs<PARTICLECONTACTTYPE, true>(contact, ids)) {
+      updateContact(contact, particle1, particle2, pos, cellMin, cellMax,
+                    getSetupPeriodicity, deltaX);
     }
     else {
-      updateContact(*(contactContainer.particleContacts.end() - 1), particle2,
-                    particle1, pos, cellMin, cellMax, getSetupPeriodicity,
-                    deltaX);
+      updateContact(contact, particle2, particle1, pos, cellMin, cellMax,
+                    getSetupPeriodicity, deltaX);
     }
   }
 }
@@ -308,14 +300,8 @@ void updateContacts(
     const PhysR<T, PARTICLETYPE::d>& cellMin,
     const PhysR<T, PARTICLETYPE::d>& cellMax, F getSetupPeriodicity, T deltaX)
 {
-  // find the contact by checking ids
-  const std::function<bool(const WALLCONTACTTYPE&)> condition =
-      [&particleID, &wallID](const WALLCONTACTTYPE& contact) {
-        return particleID == contact.getParticleID() &&
-               wallID == contact.getWallID();
-      };
-  auto contactIt =
-      getContactIterator(contactContainer.wallContacts, condition);
+  // find the contact by its ids using the hashed lookup
+  auto contactIt = contactContainer.findWallContact(particleID, wallID);
 
   if (contactIt != std::end(contactContainer.wallContacts)) {
     if (contactIt->isNew()) {
@@ -324,10 +310,9 @@ void updateContacts(
     }
   }
   else {
-    contactContainer.wallContacts.push_back(
-        WALLCONTACTTYPE(particleID, wallID));
-    updateContact(*(contactContainer.wallContacts.end() - 1), particle, pos,
-                  cellMin, cellMax, getSetupPeriodicity, deltaX);
+    updateContact(contactContainer.addWallContact(particleID, wallID),
+                  particle, pos, cellMin, cellMax, getSetupPeriodicity,
+                  deltaX);
   }
 }
 
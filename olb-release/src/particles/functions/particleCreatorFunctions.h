@@ -542,7 +542,7 @@ updateParticlePositions(std::vector<SpawnData<T, PARTICLETYPE::d>> spawnData,
                         XParticleSystem<T, PARTICLETYPE>& particleSystem
 #ifdef PARALLEL_MODE_MPI
                         ,
-                        MPI_Comm particleCreatorComm = MPI_COMM_WORLD
+                        MPI_Comm particleCreatorComm = singleton::mpi().getCommunicator()
 #endif
 )
 {
@@ -654,7 +654,7 @@ std::vector<SpawnData<T, PARTICLETYPE::d>> saveUpdatedParticlePositions(
     XParticleSystem<T, PARTICLETYPE>&                     particleSystem
 #ifdef PARALLEL_MODE_MPI
     ,
-    MPI_Comm particleCreatorComm = MPI_COMM_WORLD
+    MPI_Comm particleCreatorComm = singleton::mpi().getCommunicator()
 #endif
 )
 {
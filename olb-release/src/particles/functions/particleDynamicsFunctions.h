@@ -197,6 +197,11 @@ void applySerializableParticleForce( FORCEFUNCTOR& forceF, ParticleSystem<T,PART
 template<typename T, typename PARTICLETYPE, typename FORCEFUNCTOR, typename PCONDITION=conditions::valid_particles>
 void applyLocalParticleForce( FORCEFUNCTOR& forceF, ParticleSystem<T,PARTICLETYPE>& particleSystem, std::size_t iP0=0 )
 {
+  //Evaluate all particles at once, if the functor provides a batched evaluation
+  if constexpr (requires { forceF.template evaluateAll<PCONDITION>(); }) {
+    forceF.template evaluateAll<PCONDITION>();
+    return;
+  }
   //Iterate over particles and apply functor's evaluate() directly
   for (std::size_t iP=iP0; iP!=particleSystem.size(); iP++) {
     auto particle = particleSystem.get(iP);
@@ -297,6 +302,9 @@ void coupleResolvedParticlesToLattice(
   constexpr unsigned D = DESCRIPTOR::d;
   using namespace descriptors;
 
+  // Contacts may have been modified by communication since the last sweep
+  contactContainer.updateContactIndices();
+
   const PhysR<T,D> min = communication::getCuboidMin<T,D>(sGeometry.getCuboidDecomposition());
   const PhysR<T,D> max = communication::getCuboidMax<T,D>(sGeometry.getCuboidDecomposition(), min);
 
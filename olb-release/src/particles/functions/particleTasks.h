@@ -25,6 +25,8 @@
 /* This file containes particle tasks that can be passed to the particle manager.
  * Those need to provide an execute method, and two booleans specifying the coupling
  * and the necessity for beeing looped over all particles.
+ * Looped tasks may additionally declare `threadSafe`, if they only modify the particle
+ * they are executed for, which allows the particle manager to process particles concurrently.
 */
 
 #ifndef PARTICLE_TASKS_H
@@ -37,6 +39,14 @@ namespace olb {
 
 namespace particles {
 
+/// Check whether TASK only modifies the particle it is executed for (defaults to false)
+template<typename TASK, typename = void>
+struct is_thread_safe_task : std::false_type {};
+
+template<typename TASK>
+struct is_thread_safe_task<TASK, std::void_t<decltype(TASK::threadSafe)>>
+  : std::integral_constant<bool, TASK::threadSafe> {};
+
 /// Couple lattice to particles
 template<typename T, typename DESCRIPTOR, typename PARTICLETYPE,
          typename FORCEFUNCTOR=SuperLatticeMomentumExchangeForce<T, DESCRIPTOR, PARTICLETYPE>>
@@ -78,6 +88,7 @@ struct apply_external_acceleration_single_cuboid{
   }
   static constexpr bool latticeCoupling = false;
   static constexpr bool particleLoop = true;
+  static constexpr bool threadSafe = true;
 };
 
 /// Process particle dynamics
@@ -99,6 +110,7 @@ struct process_dynamics_single_cuboid{
   }
   static constexpr bool latticeCoupling = false;
   static constexpr bool particleLoop = true;
+  static constexpr bool threadSafe = true;
 };
 
 /// Couple particles to lattice
@@ -153,6 +165,7 @@ struct process_dynamics_parallel{
   }
   static constexpr bool latticeCoupling = false;
   static constexpr bool particleLoop = true;
+  static constexpr bool threadSafe = true;
 };
 
 
@@ -373,6 +386,7 @@ struct apply_external_acceleration_parallel{
   }
   static constexpr bool latticeCoupling = false;
   static constexpr bool particleLoop = true;
+  static constexpr bool threadSafe = true;
 };
 
 
@@ -393,6 +407,7 @@ struct clear_force_and_torque{
   }
   static constexpr bool latticeCoupling = false;
   static constexpr bool particleLoop = true;
+  static constexpr bool threadSafe = true;
 };
 
 ///Euler Rotation -computes the orientation of the main axis of the spheroid to the streamline
@@ -416,6 +431,7 @@ struct compute_orientation_index{
   }
   static constexpr bool latticeCoupling = false;
   static constexpr bool particleLoop = true;
+  static constexpr bool threadSafe = true;
 };
 
 
@@ -53,6 +53,13 @@ private:
   template <typename TASK>
   using requires_no_loop = std::integral_constant<bool, !TASK::particleLoop>;
 
+  //Check whether all looped TASKs allow for concurrent processing of particles
+  template<typename taskList, std::size_t... Is>
+  static constexpr bool threadSafeTasks(std::index_sequence<Is...>)
+  {
+    return (is_thread_safe_task<typename taskList::template get<Is>>::value && ...);
+  }
+
   //Unpack tasks requiring loop
   template<typename taskList, typename ISEQ>
   void unpackTasksLooped(Particle<T,PARTICLETYPE>& particle, T timeStepSize, ISEQ seq, int globiC=0);
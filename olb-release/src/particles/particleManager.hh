@@ -130,22 +130,35 @@ void ParticleManager<T,DESCRIPTOR,PARTICLETYPE>::execute(T timeStepSize){
   };
   //Define function for sequence of tasks requiring loop
   auto executeLoopedTasks = [&](auto indexSequence){
+    //Process particles concurrently if all tasks only modify their own particle
+    constexpr bool threadSafe = threadSafeTasks<taskList>(decltype(indexSequence){});
     if constexpr( access::providesParallelization<PARTICLETYPE>() ){
       //Loop over valid particles
-      communication::forParticlesInSuperParticleSystem<T,PARTICLETYPE,
-        conditions::valid_particles>( _xParticleSystem,
-        [&](Particle<T,PARTICLETYPE>& particle,
+      auto f = [&](Particle<T,PARTICLETYPE>& particle,
         ParticleSystem<T,PARTICLETYPE>& particleSystem, int globiC){
         //Unpack tasks to be looped
         unpackTasksLooped<taskList>( particle, timeStepSize, indexSequence, globiC );
-      });
+      };
+      if constexpr (threadSafe) {
+        communication::forParticlesInSuperParticleSystemParallel<T,PARTICLETYPE,
+          conditions::valid_particles>( _xParticleSystem, f );
+      } else {
+        communication::forParticlesInSuperParticleSystem<T,PARTICLETYPE,
+          conditions::valid_particles>( _xParticleSystem, f );
+      }
     } else {
       //Loop over all particles
-      forParticlesInParticleSystem<T,PARTICLETYPE,conditions::all_particles>( _xParticleSystem,
-        [&](Particle<T,PARTICLETYPE>& particle){
+      auto f = [&](Particle<T,PARTICLETYPE>& particle){
         //Unpack tasks to be looped
         unpackTasksLooped<taskList>( particle, timeStepSize, indexSequence, 0 );
-      });
+      };
+      if constexpr (threadSafe) {
+        forParticlesInParticleSystemParallel<T,PARTICLETYPE,conditions::all_particles>(
+          _xParticleSystem, f );
+      } else {
+        forParticlesInParticleSystem<T,PARTICLETYPE,conditions::all_particles>(
+          _xParticleSystem, f );
+      }
     }
    };
    //Evaluate index sequence and evaluate tasks or tasks sequences
@@ -377,16 +377,8 @@ void setBlockParticleField(
               std::size_t localiP2 = iP2;
               if constexpr (particles::access::providesParallelization<
                                 PARTICLETYPE>()) {
-                for (std::size_t localiP = 0; localiP < particleSystem.size();
-                     ++localiP) {
-                  const std::size_t globalParticleID =
-                      particleSystem.get(localiP)
-                          .template getField<PARALLELIZATION, ID>();
-                  if (globalParticleID == iP2) {
-                    localiP2 = localiP;
-                    break;
-                  }
-                }
+                localiP2 =
+                    contactContainer.getLocalParticleIndex(particleSystem, iP2);
               }
               auto particle2 = particleSystem.get(localiP2);
 
@@ -266,7 +266,6 @@ std::unique_ptr<SuperLatticeRefinement<T,DESCRIPTOR>> makeCoarseToFineCoupler(
 {
   auto& loadBalancerFine = dynamic_cast<RefinedLoadBalancer<T,DESCRIPTOR::d>&>(
     sLatticeFine.getLoadBalancer());
-  auto& loadBalancerCoarse = sLatticeCoarse.getLoadBalancer();
   auto& cDecompositionFine = sLatticeFine.getCuboidDecomposition();
   const auto& converterCoarse = sLatticeCoarse.getConverter();
 
@@ -299,8 +298,7 @@ std::unique_ptr<SuperLatticeRefinement<T,DESCRIPTOR>> makeCoarseToFineCoupler(
             coarseToFine->getBlock(iC).add(fineLatticeR);
 
             // Coarse populations need to be up to date for FullTimeCoarseToFineO
-            auto coarseLatticeR = (fineLatticeR / 2).withPrefix(
-              loadBalancerCoarse.glob(loadBalancerFine.cloc(iC)));
+            auto coarseLatticeR = (fineLatticeR / 2).withPrefix(loadBalancerFine.cloc(iC));
             coarseToFineCommunicatorCoarse.requestCell(coarseLatticeR);
           }
         }
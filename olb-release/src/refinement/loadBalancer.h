@@ -27,6 +27,9 @@
 #include "communication/loadBalancer.h"
 #include "geometry/cuboidDecomposition.h"
 
+#include <numeric>
+#include <optional>
+
 namespace olb {
 
 /// Load balancer for refined lattice hierarchies
@@ -98,6 +101,110 @@ public:
 
 };
 
+
+/// Load balancer for the coarsest level of a refined lattice hierarchy
+/**
+ * Distributes the coarse cuboids by the total work of their refinement
+ * subtree. Every cuboid on level l contributes
+ *
+ *   cells x 2^l x dynamicsCost[l]
+ *
+ * to the load of its coarsest ancestor, where cells is the cuboid weight
+ * (lattice volume unless set otherwise, e.g. to the number of fluid cells)
+ * and 2^l the number of sub steps per coarse time step.
+ *
+ * Finer levels are to be assigned using RefinedLoadBalancer as the current
+ * refinement couplers require each fine block to reside next to its coarse parent.
+ **/
+template<typename T, unsigned D>
+class HierarchicLoadBalancer final : public LoadBalancer<T> {
+private:
+  /// Total work of each coarse cuboid including all its descendants
+  std::vector<double> _work;
+
+public:
+  HierarchicLoadBalancer(CuboidDecomposition<T,D>& coarseGeometry,
+                         std::vector<CuboidDecomposition<T,D>*> fineGeometries,
+                         std::vector<double> dynamicsCost = {})
+    : LoadBalancer<T>(0),
+      _work(coarseGeometry.size(), 0)
+  {
+    OstreamManager clout(std::cout, "HierarchicLoadBalancer");
+    dynamicsCost.resize(fineGeometries.size()+1, 1);
+
+    for (int iC=0; iC < coarseGeometry.size(); ++iC) {
+      _work[iC] = dynamicsCost[0] * coarseGeometry.get(iC).getWeight();
+    }
+    for (std::size_t iLevel=0; iLevel < fineGeometries.size(); ++iLevel) {
+      auto& fineGeometry = *fineGeometries[iLevel];
+      const double levelCost = util::pow(2., iLevel+1.) * dynamicsCost[iLevel+1];
+      for (int iC=0; iC < fineGeometry.size(); ++iC) {
+        // Walk up the hierarchy to the coarsest ancestor
+        auto origin = fineGeometry.get(iC).getOrigin();
+        std::optional<int> ancestorC;
+        for (int jLevel=int(iLevel)-1; jLevel >= -1; --jLevel) {
+          auto& parentGeometry = jLevel >= 0 ? *fineGeometries[jLevel] : coarseGeometry;
+          if (auto latticeR = parentGeometry.getLatticeR(origin)) {
+            ancestorC = (*latticeR)[0];
+            origin = parentGeometry.get(*ancestorC).getOrigin();
+          } else {
+            ancestorC = std::nullopt;
+            break;
+          }
+        }
+        if (!ancestorC) {
+          throw std::invalid_argument("Fine cuboid " + std::to_string(iC)
+                                      + " on level " + std::to_string(iLevel+1)
+                                      + " is not nested in its parent level");
+        }
+        _work[*ancestorC] += levelCost * fineGeometry.get(iC).getWeight();
+      }
+    }
+
+    int size = 1;
+    #ifdef PARALLEL_MODE_MPI
+    size = util::max<int>(singleton::mpi().getSize(), 1);
+    #endif
+
+    // Greedy largest-first assignment to the least loaded rank.
+    // Deterministic on all ranks, so no result broadcast is required.
+    std::vector<int> order(coarseGeometry.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int iC, int jC) {
+      return _work[iC] > _work[jC];
+    });
+    std::vector<double> currentLoad(size, 0);
+    for (int iC : order) {
+      const int iRank = std::distance(currentLoad.begin(),
+                                      std::min_element(currentLoad.begin(), currentLoad.end()));
+      currentLoad[iRank] += _work[iC];
+      this->_rank[iC] = iRank;
+    }
+    for (int iC=0; iC < coarseGeometry.size(); ++iC) {
+      if (this->_rank[iC] == singleton::mpi().getRank()) {
+        this->_loc[iC] = this->_glob.size();
+        this->_glob.push_back(iC);
+      }
+    }
+    this->_size = this->_glob.size();
+
+    const double totalWork = std::accumulate(_work.begin(), _work.end(), 0.);
+    const double maxLoad = *std::max_element(currentLoad.begin(), currentLoad.end());
+    clout << "Expected imbalance (max/mean load): " << maxLoad / (totalWork / size) << std::endl;
+    const double maxWork = *std::max_element(_work.begin(), _work.end());
+    if (size > 1 && maxWork > totalWork / size) {
+      clout << "Largest refinement subtree exceeds mean rank load, "
+            << "consider splitting its coarse cuboid" << std::endl;
+    }
+  }
+
+  /// Returns total work of coarse cuboid iC including all its descendants
+  double getWork(int iC) const {
+    return _work.at(iC);
+  }
+
+};
+
 }
 
 #endif
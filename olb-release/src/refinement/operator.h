@@ -51,6 +51,8 @@ struct BlockRefinementContextD {
 
   using Data = olb::BlockD<T,refinement::DATA_DESCRIPTOR<DESCRIPTOR>>;
 
+  virtual ~BlockRefinementContextD() = default;
+
   virtual Platform getPlatform() const = 0;
   virtual void setProcessingContext(ProcessingContext context) = 0;
 
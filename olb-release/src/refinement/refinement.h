@@ -38,5 +38,8 @@
 
 #include "algorithm/lagrava.h"
 
+#include "superLatticeHierarchy.h"
+#include "superLatticeAdaptiveRefinement.h"
+
 
 #endif
@@ -0,0 +1,379 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+*/
+
+#ifndef REFINEMENT_SUPER_LATTICE_ADAPTIVE_REFINEMENT_H
+#define REFINEMENT_SUPER_LATTICE_ADAPTIVE_REFINEMENT_H
+
+#include <functional>
+#include <set>
+
+#include "superLatticeHierarchy.h"
+
+namespace olb {
+
+template <typename T, typename DESCRIPTOR> class BlockLatticeRefinementMetricKnudsen2D;
+template <typename T, typename DESCRIPTOR> class BlockLatticeRefinementMetricKnudsen3D;
+
+namespace refinement {
+
+/// Initialize fine block by multilinear interpolation of its coarse parent block
+/**
+ * Both blocks must share their origin. Density, velocity and the rescaled
+ * non-equilibrium populations of the surrounding coarse nodes are interpolated
+ * to each fine core cell, matching the scaling of the lagrava couplers.
+ **/
+template <typename T, typename DESCRIPTOR>
+void initializeFromCoarse(BlockLattice<T,DESCRIPTOR>& cBlock,
+                          BlockLattice<T,DESCRIPTOR>& fBlock,
+                          T coarseTau)
+{
+  const T scalingFactor = (coarseTau - T{0.25}) / coarseTau;
+
+  fBlock.forCoreSpatialLocations([&](LatticeR<DESCRIPTOR::d> fineLatticeR) {
+    T rho{};
+    Vector<T,DESCRIPTOR::d> u{};
+    Vector<T,DESCRIPTOR::q> fNeq{};
+
+    // Visit all coarse nodes surrounding the fine location
+    for (unsigned iCorner=0; iCorner < (1u << DESCRIPTOR::d); ++iCorner) {
+      LatticeR<DESCRIPTOR::d> coarseLatticeR{};
+      T weight = 1;
+      bool isCorner = true;
+      for (unsigned iD=0; iD < DESCRIPTOR::d; ++iD) {
+        const int isOdd = fineLatticeR[iD] & 1;
+        const int offset = (iCorner >> iD) & 1;
+        if (!isOdd && offset) {
+          isCorner = false;
+          break;
+        }
+        coarseLatticeR[iD] = (fineLatticeR[iD] - isOdd) / 2 + offset;
+        weight *= isOdd ? T{0.5} : T{1};
+      }
+      if (isCorner) {
+        auto cCell = cBlock.get(coarseLatticeR);
+        T rho_{};
+        Vector<T,DESCRIPTOR::d> u_{};
+        Vector<T,DESCRIPTOR::q> fNeq_{};
+        lbm<DESCRIPTOR>::computeRhoU(cCell, rho_, u_);
+        lbm<DESCRIPTOR>::computeFneq(cCell, fNeq_, rho_, u_);
+        rho  += weight * rho_;
+        u    += weight * u_;
+        fNeq += weight * fNeq_;
+      }
+    }
+
+    const T uSqr = util::normSqr<T,DESCRIPTOR::d>(u);
+    auto fCell = fBlock.get(fineLatticeR);
+    for (int iPop=0; iPop < DESCRIPTOR::q; ++iPop) {
+      fCell[iPop] = equilibrium<DESCRIPTOR>::secondOrder(iPop, rho, u, uSqr) + scalingFactor*fNeq[iPop];
+    }
+  });
+}
+
+}
+
+/// Solution-adaptive re-gridding of the finest level of a SuperLatticeHierarchy
+/**
+ * The finest level is composed of refined copies of a subset of the cuboids
+ * of the next coarser level. Calling adapt() evaluates the Knudsen refinement
+ * metric (Lagrava et al.) per coarse cuboid and re-grids the finest level if
+ * cuboids are to be refined or coarsened:
+ *
+ *   - metric >= refinement threshold:   cuboid is refined
+ *   - metric <  coarsening threshold:   refined cuboid is coarsened
+ *
+ * Fine blocks that persist across a re-gridding keep their populations,
+ * new fine blocks are initialized by interpolation of their coarse parent.
+ * The couplers and communicators of the finest level are rebuilt afterwards.
+ *
+ * The granularity of adaptation is given by the coarse cuboid decomposition.
+ * Only cuboids whose refined copy is fully set up by the prepare callback
+ * (e.g. not touching boundaries of the coarse level) should be refinable.
+ **/
+template <typename T, typename DESCRIPTOR>
+class SuperLatticeAdaptiveRefinement {
+private:
+  using MetricF = std::conditional_t<
+    DESCRIPTOR::d == 3,
+    BlockLatticeRefinementMetricKnudsen3D<T,DESCRIPTOR>,
+    BlockLatticeRefinementMetricKnudsen2D<T,DESCRIPTOR>
+  >;
+
+  SuperLatticeHierarchy<T,DESCRIPTOR>& _hierarchy;
+  /// Index of the coarse level of the adapted level pair
+  const std::size_t _iCoarseLevel;
+
+  /// Sets up material numbers, dynamics, boundaries and parameters of a new fine level
+  std::function<void(SuperGeometry<T,DESCRIPTOR::d>&,SuperLattice<T,DESCRIPTOR>&)> _prepare;
+  /// Returns true iff coarse cuboid may be refined
+  std::function<bool(int)> _isRefinable;
+
+  T _refinementThreshold = 1;
+  T _coarseningThreshold = 0.5;
+
+  /// Coarse cuboids that stay refined regardless of the metric
+  std::set<int> _persistent;
+  /// Coarse parent of each fine cuboid
+  std::vector<int> _coarseC;
+
+  std::unique_ptr<UnitConverter<T,DESCRIPTOR>> _converter;
+  std::unique_ptr<CuboidDecomposition<T,DESCRIPTOR::d>> _cuboidDecomposition;
+  std::unique_ptr<RefinedLoadBalancer<T,DESCRIPTOR::d>> _loadBalancer;
+  std::unique_ptr<SuperGeometry<T,DESCRIPTOR::d>> _sGeometry;
+  std::unique_ptr<SuperLattice<T,DESCRIPTOR>> _sLattice;
+
+  OstreamManager clout;
+
+  SuperLattice<T,DESCRIPTOR>& getCoarseLattice() {
+    return _hierarchy.getLattice(_iCoarseLevel);
+  }
+
+public:
+  /**
+   * \param hierarchy Hierarchy whose current finest level is to be refined adaptively
+   * \param prepare   Called for each new fine level to set up its geometry and lattice
+   **/
+  SuperLatticeAdaptiveRefinement(
+    SuperLatticeHierarchy<T,DESCRIPTOR>& hierarchy,
+    std::function<void(SuperGeometry<T,DESCRIPTOR::d>&,SuperLattice<T,DESCRIPTOR>&)> prepare)
+    : _hierarchy(hierarchy),
+      _iCoarseLevel(hierarchy.size()-1),
+      _prepare(prepare),
+      _isRefinable([](int) { return true; }),
+      _converter(new UnitConverter<T,DESCRIPTOR>(
+        convectivelyRefineUnitConverter(hierarchy.getLattice(hierarchy.size()-1).getConverter(), 2))),
+      clout(std::cout, "SuperLatticeAdaptiveRefinement")
+  { }
+
+  /// Set metric thresholds for refining resp. coarsening a coarse cuboid
+  void setThresholds(T refinementThreshold, T coarseningThreshold) {
+    if (coarseningThreshold > refinementThreshold) {
+      throw std::invalid_argument("Coarsening threshold must not exceed refinement threshold");
+    }
+    _refinementThreshold = refinementThreshold;
+    _coarseningThreshold = coarseningThreshold;
+  }
+
+  /// Restrict adaptation to coarse cuboids for which isRefinable returns true
+  void setRefinable(std::function<bool(int)> isRefinable) {
+    _isRefinable = isRefinable;
+  }
+
+  /// Declare coarse cuboids that are always refined (e.g. containing geometry only resolved on the fine level)
+  void setPersistent(const std::set<int>& coarseCuboids) {
+    _persistent = coarseCuboids;
+  }
+
+  bool isRefined() const {
+    return bool(_sLattice);
+  }
+  /// Returns set of currently refined coarse cuboids
+  std::set<int> getRefined() const {
+    return std::set<int>(_coarseC.begin(), _coarseC.end());
+  }
+
+  /// Fine level lattice, only valid until the next re-gridding
+  SuperLattice<T,DESCRIPTOR>& getLattice() {
+    return *_sLattice;
+  }
+  /// Fine level geometry, only valid until the next re-gridding
+  SuperGeometry<T,DESCRIPTOR::d>& getGeometry() {
+    return *_sGeometry;
+  }
+  const UnitConverter<T,DESCRIPTOR>& getConverter() const {
+    return *_converter;
+  }
+
+  /// Evaluate refinement metric for all coarse cuboids
+  std::vector<T> evaluateMetric();
+
+  /// Re-grid finest level to refine exactly the given coarse cuboids (and all persistent ones)
+  void refine(std::set<int> coarseCuboids);
+
+  /// Evaluate metric and re-grid if the set of refined cuboids changes
+  /**
+   * \return true iff the finest level was re-gridded
+   **/
+  bool adapt();
+
+};
+
+
+template <typename T, typename DESCRIPTOR>
+std::vector<T> SuperLatticeAdaptiveRefinement<T,DESCRIPTOR>::evaluateMetric()
+{
+  auto& sLatticeCoarse = getCoarseLattice();
+  auto& load = sLatticeCoarse.getLoadBalancer();
+  const int nC = sLatticeCoarse.getCuboidDecomposition().size();
+
+  sLatticeCoarse.setProcessingContext(ProcessingContext::Evaluation);
+
+  std::vector<T> metric(nC, T{});
+  for (int iC = 0; iC < load.size(); ++iC) {
+    MetricF metricF(sLatticeCoarse.getBlock(iC), sLatticeCoarse.getConverter());
+    T output[1] { };
+    metricF(output);
+    metric[load.glob(iC)] = output[0];
+  }
+
+  #ifdef PARALLEL_MODE_MPI
+  std::vector<T> globalMetric(nC, T{});
+  singleton::mpi().allreduce(metric.data(), globalMetric.data(), nC, MPI_SUM);
+  return globalMetric;
+  #else
+  return metric;
+  #endif
+}
+
+template <typename T, typename DESCRIPTOR>
+bool SuperLatticeAdaptiveRefinement<T,DESCRIPTOR>::adapt()
+{
+  const auto metric = evaluateMetric();
+  const auto refined = getRefined();
+
+  std::set<int> flagged;
+  for (int iC=0; iC < static_cast<int>(metric.size()); ++iC) {
+    if (!_isRefinable(iC)) {
+      continue;
+    }
+    if (metric[iC] >= _refinementThreshold
+     || (refined.contains(iC) && metric[iC] >= _coarseningThreshold)) {
+      flagged.insert(iC);
+    }
+  }
+  flagged.insert(_persistent.begin(), _persistent.end());
+
+  if (flagged == refined) {
+    return false;
+  }
+  refine(flagged);
+  return true;
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeAdaptiveRefinement<T,DESCRIPTOR>::refine(std::set<int> coarseCuboids)
+{
+  coarseCuboids.insert(_persistent.begin(), _persistent.end());
+
+  auto& sLatticeCoarse = getCoarseLattice();
+  auto& cDecompositionCoarse = sLatticeCoarse.getCuboidDecomposition();
+  auto& loadBalancerCoarse = sLatticeCoarse.getLoadBalancer();
+
+  // Pending background tasks (e.g. VTK output) may still refer to the previous fine level
+  singleton::pool().wait();
+
+  if (_sLattice) {
+    _hierarchy.removeFinestLevel();
+  }
+
+  std::unique_ptr<CuboidDecomposition<T,DESCRIPTOR::d>> cuboidDecomposition;
+  std::unique_ptr<RefinedLoadBalancer<T,DESCRIPTOR::d>> loadBalancer;
+  std::unique_ptr<SuperGeometry<T,DESCRIPTOR::d>> sGeometry;
+  std::unique_ptr<SuperLattice<T,DESCRIPTOR>> sLattice;
+  std::vector<int> coarseC(coarseCuboids.begin(), coarseCuboids.end());
+
+  if (!coarseC.empty()) {
+    // Fine cuboids are refined copies of the flagged coarse cuboids (in order)
+    cuboidDecomposition.reset(new CuboidDecomposition<T,DESCRIPTOR::d>(cDecompositionCoarse));
+    for (int iC=cDecompositionCoarse.size()-1; iC >= 0; --iC) {
+      if (!coarseCuboids.contains(iC)) {
+        cuboidDecomposition->remove(iC);
+      }
+    }
+    cuboidDecomposition->refine(2);
+
+    loadBalancer.reset(new RefinedLoadBalancer<T,DESCRIPTOR::d>(
+      cDecompositionCoarse, loadBalancerCoarse, *cuboidDecomposition));
+    sGeometry.reset(new SuperGeometry<T,DESCRIPTOR::d>(*cuboidDecomposition, *loadBalancer));
+    sLattice.reset(new SuperLattice<T,DESCRIPTOR>(*cuboidDecomposition,
+                                                  *loadBalancer,
+                                                  sLatticeCoarse.getOverlap(),
+                                                  *_converter));
+    _prepare(*sGeometry, *sLattice);
+
+    sLatticeCoarse.setProcessingContext(ProcessingContext::Evaluation);
+    sLatticeCoarse.communicate();
+    if (_sLattice) {
+      _sLattice->setProcessingContext(ProcessingContext::Evaluation);
+    }
+    sLattice->setProcessingContext(ProcessingContext::Evaluation);
+
+    const T coarseTau = sLatticeCoarse.getConverter().getLatticeRelaxationTime();
+    int nPersisting = 0;
+    for (int iC=0; iC < loadBalancer->size(); ++iC) {
+      const int coarseGlob = coarseC[loadBalancer->glob(iC)];
+      auto& fBlock = sLattice->getBlock(iC);
+      auto prevFineC = std::find(_coarseC.begin(), _coarseC.end(), coarseGlob);
+      if (prevFineC != _coarseC.end()) {
+        // Persisting fine block keeps its populations
+        auto& prevBlock = _sLattice->getBlock(_loadBalancer->loc(prevFineC - _coarseC.begin()));
+        fBlock.forCoreSpatialLocations([&](LatticeR<DESCRIPTOR::d> latticeR) {
+          auto cell = fBlock.get(latticeR);
+          auto prevCell = prevBlock.get(latticeR);
+          for (int iPop=0; iPop < DESCRIPTOR::q; ++iPop) {
+            cell[iPop] = prevCell[iPop];
+          }
+        });
+        nPersisting += 1;
+      } else {
+        refinement::initializeFromCoarse(sLatticeCoarse.getBlock(loadBalancer->cloc(iC)),
+                                         fBlock,
+                                         coarseTau);
+      }
+    }
+    sLattice->setProcessingContext(ProcessingContext::Simulation);
+
+    #ifdef PARALLEL_MODE_MPI
+    singleton::mpi().reduceAndBcast(nPersisting, MPI_SUM);
+    #endif
+    clout << "Refined " << coarseC.size() << " coarse cuboids ("
+          << static_cast<int>(coarseC.size()) - nPersisting << " new, "
+          << static_cast<int>(_coarseC.size()) - nPersisting << " removed)" << std::endl;
+  } else {
+    clout << "Removed all refined cuboids" << std::endl;
+  }
+
+  // Release previous fine level in reverse order of construction
+  _sLattice.reset();
+  _sGeometry.reset();
+  _loadBalancer.reset();
+  _cuboidDecomposition.reset();
+
+  _cuboidDecomposition = std::move(cuboidDecomposition);
+  _loadBalancer = std::move(loadBalancer);
+  _sGeometry = std::move(sGeometry);
+  _sLattice = std::move(sLattice);
+  _coarseC = std::move(coarseC);
+
+  if (_sLattice) {
+    _hierarchy.addLevel(*_sLattice, *_sGeometry);
+    _sLattice->getCommunicator(stage::Full()).communicate();
+    _sLattice->initialize();
+    _hierarchy.getCoarseToFineCoupler(_iCoarseLevel).apply(meta::id<refinement::lagrava::InitializeO>{});
+  }
+}
+
+}
+
+#endif
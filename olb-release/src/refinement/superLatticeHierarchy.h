@@ -0,0 +1,270 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+ */
+
+#ifndef REFINEMENT_SUPER_LATTICE_HIERARCHY_H
+#define REFINEMENT_SUPER_LATTICE_HIERARCHY_H
+
+#include <chrono>
+
+#include "superLatticeRefinement.h"
+#include "algorithm/lagrava.h"
+
+namespace olb {
+
+/// Recursive local time stepping of a hierarchy of convectively refined lattices
+/**
+ * Level 0 is the coarsest lattice, each level i+1 is refined by a factor of
+ * two w.r.t. level i and coupled to it using the Lagrava et al. operators.
+ * One call to collideAndStream advances level 0 by a single time step and
+ * each level i by 2^i steps, i.e. it is equivalent to the manual sequence
+ *
+ *   coarse.collideAndStream();
+ *   fine.collideAndStream();
+ *   coarseToFine->apply(meta::id<HalfTimeCoarseToFineO>{});
+ *   fine.collideAndStream();
+ *   coarseToFine->apply(meta::id<FullTimeCoarseToFineO>{});
+ *   fineToCoarse->apply(meta::id<FineToCoarseO>{});
+ *
+ * applied recursively to all levels.
+ *
+ * As the first fine sub-step only depends on fine data, the propagation
+ * overlap communication of each coarse level is kept in flight while the
+ * first sub-step of all finer levels is computed.
+ **/
+template <typename T, typename DESCRIPTOR>
+class SuperLatticeHierarchy {
+private:
+  using clock = std::chrono::steady_clock;
+
+  struct Level {
+    SuperLattice<T,DESCRIPTOR>* lattice;
+    SuperGeometry<T,DESCRIPTOR::d>* geometry;
+    /// Couplers to the next finer level (if any)
+    std::unique_ptr<SuperLatticeRefinement<T,DESCRIPTOR>> coarseToFine;
+    std::unique_ptr<SuperLatticeRefinement<T,DESCRIPTOR>> fineToCoarse;
+
+    /// Accumulated seconds spent in lattice steps of this level
+    double latticeTime = 0;
+    /// Accumulated seconds spent in coupling this level to the next finer one
+    double couplingTime = 0;
+    std::size_t nSteps = 0;
+  };
+
+  std::vector<Level> _levels;
+
+  OstreamManager clout;
+
+  static double elapsed(clock::time_point start) {
+    return std::chrono::duration<double>(clock::now() - start).count();
+  }
+
+  /// Advance level iLevel by one of its time steps, sub-cycling all finer levels
+  void step(std::size_t iLevel);
+
+public:
+  SuperLatticeHierarchy(SuperLattice<T,DESCRIPTOR>& sLattice,
+                        SuperGeometry<T,DESCRIPTOR::d>& sGeometry);
+
+  /// Add refined level coupled to the current finest level using the given couplers
+  void addLevel(SuperLattice<T,DESCRIPTOR>& sLattice,
+                SuperGeometry<T,DESCRIPTOR::d>& sGeometry,
+                std::unique_ptr<SuperLatticeRefinement<T,DESCRIPTOR>>&& coarseToFine,
+                std::unique_ptr<SuperLatticeRefinement<T,DESCRIPTOR>>&& fineToCoarse);
+  /// Add refined level coupled to the current finest level using the default lagrava couplers
+  /**
+   * The lattice must be distributed using RefinedLoadBalancer w.r.t. the
+   * current finest level and all its boundaries must already be set up.
+   **/
+  void addLevel(SuperLattice<T,DESCRIPTOR>& sLattice,
+                SuperGeometry<T,DESCRIPTOR::d>& sGeometry);
+  /// Remove finest level and its couplers (e.g. prior to re-gridding)
+  void removeFinestLevel();
+
+  /// Number of levels
+  std::size_t size() const {
+    return _levels.size();
+  }
+
+  SuperLattice<T,DESCRIPTOR>& getLattice(std::size_t iLevel) {
+    return *_levels.at(iLevel).lattice;
+  }
+  SuperGeometry<T,DESCRIPTOR::d>& getGeometry(std::size_t iLevel) {
+    return *_levels.at(iLevel).geometry;
+  }
+  SuperLatticeRefinement<T,DESCRIPTOR>& getCoarseToFineCoupler(std::size_t iLevel) {
+    return *_levels.at(iLevel).coarseToFine;
+  }
+  SuperLatticeRefinement<T,DESCRIPTOR>& getFineToCoarseCoupler(std::size_t iLevel) {
+    return *_levels.at(iLevel).fineToCoarse;
+  }
+
+  /// Initialize coupling data of all levels (after initial values are set)
+  void initialize();
+
+  /// Advance coarsest level by one time step and all finer levels accordingly
+  void collideAndStream();
+
+  /// Reset per-level timings
+  void resetTimings();
+  /// Print accumulated per-level timings (maximum over all ranks)
+  void printTimings();
+
+};
+
+
+template <typename T, typename DESCRIPTOR>
+SuperLatticeHierarchy<T,DESCRIPTOR>::SuperLatticeHierarchy(SuperLattice<T,DESCRIPTOR>& sLattice,
+                                                           SuperGeometry<T,DESCRIPTOR::d>& sGeometry)
+  : clout(std::cout, "SuperLatticeHierarchy")
+{
+  _levels.emplace_back(Level{&sLattice, &sGeometry, nullptr, nullptr});
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeHierarchy<T,DESCRIPTOR>::addLevel(
+  SuperLattice<T,DESCRIPTOR>& sLattice,
+  SuperGeometry<T,DESCRIPTOR::d>& sGeometry,
+  std::unique_ptr<SuperLatticeRefinement<T,DESCRIPTOR>>&& coarseToFine,
+  std::unique_ptr<SuperLatticeRefinement<T,DESCRIPTOR>>&& fineToCoarse)
+{
+  if (!coarseToFine || !fineToCoarse) {
+    throw std::invalid_argument("Refined levels require both coarse-to-fine and fine-to-coarse couplers");
+  }
+  _levels.back().coarseToFine = std::move(coarseToFine);
+  _levels.back().fineToCoarse = std::move(fineToCoarse);
+  _levels.emplace_back(Level{&sLattice, &sGeometry, nullptr, nullptr});
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeHierarchy<T,DESCRIPTOR>::addLevel(SuperLattice<T,DESCRIPTOR>& sLattice,
+                                                   SuperGeometry<T,DESCRIPTOR::d>& sGeometry)
+{
+  auto& coarse = _levels.back();
+  auto coarseToFine = refinement::lagrava::makeCoarseToFineCoupler(
+    *coarse.lattice, *coarse.geometry, sLattice, sGeometry);
+  auto fineToCoarse = refinement::lagrava::makeFineToCoarseCoupler(
+    *coarse.lattice, *coarse.geometry, sLattice, sGeometry);
+  addLevel(sLattice, sGeometry, std::move(coarseToFine), std::move(fineToCoarse));
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeHierarchy<T,DESCRIPTOR>::removeFinestLevel()
+{
+  if (_levels.size() < 2) {
+    throw std::logic_error("Coarsest level can not be removed from hierarchy");
+  }
+  _levels.pop_back();
+  _levels.back().coarseToFine.reset();
+  _levels.back().fineToCoarse.reset();
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeHierarchy<T,DESCRIPTOR>::initialize()
+{
+  for (auto& level : _levels) {
+    level.lattice->initialize();
+    if (level.coarseToFine) {
+      level.coarseToFine->apply(meta::id<refinement::lagrava::InitializeO>{});
+    }
+  }
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeHierarchy<T,DESCRIPTOR>::step(std::size_t iLevel)
+{
+  auto& level = _levels[iLevel];
+  const bool isRefined = iLevel+1 < _levels.size();
+
+  auto start = clock::now();
+  level.lattice->beginCollideAndStream();
+  level.latticeTime += elapsed(start);
+
+  // First sub-step of finer levels only depends on their own data
+  if (isRefined) {
+    step(iLevel+1);
+  }
+
+  start = clock::now();
+  level.lattice->endCollideAndStream();
+  level.latticeTime += elapsed(start);
+  level.nSteps += 1;
+
+  if (isRefined) {
+    start = clock::now();
+    level.coarseToFine->apply(meta::id<refinement::lagrava::HalfTimeCoarseToFineO>{});
+    level.couplingTime += elapsed(start);
+
+    step(iLevel+1);
+
+    start = clock::now();
+    level.coarseToFine->apply(meta::id<refinement::lagrava::FullTimeCoarseToFineO>{});
+    level.fineToCoarse->apply(meta::id<refinement::lagrava::FineToCoarseO>{});
+    level.couplingTime += elapsed(start);
+  }
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeHierarchy<T,DESCRIPTOR>::collideAndStream()
+{
+  step(0);
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeHierarchy<T,DESCRIPTOR>::resetTimings()
+{
+  for (auto& level : _levels) {
+    level.latticeTime = 0;
+    level.couplingTime = 0;
+    level.nSteps = 0;
+  }
+}
+
+template <typename T, typename DESCRIPTOR>
+void SuperLatticeHierarchy<T,DESCRIPTOR>::printTimings()
+{
+  for (std::size_t iLevel=0; iLevel < _levels.size(); ++iLevel) {
+    auto& level = _levels[iLevel];
+    double latticeTime = level.latticeTime;
+    double couplingTime = level.couplingTime;
+    #ifdef PARALLEL_MODE_MPI
+    singleton::mpi().reduceAndBcast(latticeTime, MPI_MAX);
+    singleton::mpi().reduceAndBcast(couplingTime, MPI_MAX);
+    #endif
+    const auto nCells = level.geometry->getStatistics().getNvoxel();
+    clout << "level=" << iLevel
+          << "; steps=" << level.nSteps
+          << "; latticeTime=" << latticeTime << "s";
+    if (level.coarseToFine) {
+      clout << "; couplingTime=" << couplingTime << "s";
+    }
+    if (latticeTime > 0) {
+      clout << "; MLUPs=" << (nCells * level.nSteps) / (1e6 * latticeTime);
+    }
+    clout << std::endl;
+  }
+}
+
+}
+
+#endif
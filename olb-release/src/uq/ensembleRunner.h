@@ -0,0 +1,192 @@
+/*  This file is part of the OpenLB library
+ *
+ *  Copyright (C) 2026 OpenLB developers
+ *  E-mail contact: info@openlb.net
+ *  The most recent release of OpenLB can be downloaded at
+ *  <http://www.openlb.net/>
+ *
+ *  This program is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU General Public License
+ *  as published by the Free Software Foundation; either version 2
+ *  of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public
+ *  License along with this program; if not, write to the Free
+ *  Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ *  Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef ENSEMBLE_RUNNER_H
+#define ENSEMBLE_RUNNER_H
+
+#include "postprocessing.h"
+
+namespace olb {
+
+namespace uq {
+
+/**
+  * \brief Concurrent execution of the samples of an ensemble on groups of processes
+  *
+  * The processes are split into nGroups disjoint groups. While a sample is simulated,
+  * the group communicator is active in singleton::mpi(), i.e. each group sets up its own
+  * CuboidDecomposition / LoadBalancer over its own processes. Samples are assigned
+  * dynamically: whenever a group is idle, its leading process fetches the next sample
+  * index from a shared counter (MPI one-sided atomics). The QoIs returned by the
+  * simulation are accumulated into StreamingStatistics on the fly and the partial
+  * statistics of all groups are combined once all samples are done.
+  */
+template <typename T>
+class EnsembleRunner {
+private:
+  UncertaintyQuantification<T>& _uq;
+  StreamingStatistics<T>        _statistics;
+  int                           _nGroups;
+  int                           _iGroup;
+#ifdef PARALLEL_MODE_MPI
+  MPI_Comm _parentComm;
+  MPI_Comm _groupComm;
+#endif
+  mutable OstreamManager clout;
+
+public:
+  EnsembleRunner(UncertaintyQuantification<T>& uq, int nGroups)
+    : _uq(uq), _statistics(uq), _nGroups(1), _iGroup(0), clout(std::cout, "EnsembleRunner")
+  {
+#ifdef PARALLEL_MODE_MPI
+    _parentComm = singleton::mpi().getCommunicator();
+    const int size = singleton::mpi().getSize();
+    const int rank = singleton::mpi().getRank();
+    _nGroups = util::max(1, util::min(nGroups, size));
+    // Contiguous ranks form a group to keep the lattice communication node-local
+    _iGroup = (static_cast<long>(rank) * _nGroups) / size;
+    MPI_Comm_split(_parentComm, _iGroup, rank, &_groupComm);
+#endif
+  }
+
+  ~EnsembleRunner()
+  {
+#ifdef PARALLEL_MODE_MPI
+    MPI_Comm_free(&_groupComm);
+#endif
+  }
+
+  EnsembleRunner(const EnsembleRunner&)            = delete;
+  EnsembleRunner& operator=(const EnsembleRunner&) = delete;
+
+  int getGroup() const
+  {
+    return _iGroup;
+  }
+
+  int getGroupsNumber() const
+  {
+    return _nGroups;
+  }
+
+  /// Simulate all samples and return the combined statistics of the QoIs
+  /**
+   * \param simulate Callable std::vector<T>(std::size_t iSample, const std::vector<T>& samplePoint),
+   *                 executed collectively by all processes of one group. The QoIs returned on
+   *                 the main process of the group enter the statistics.
+   **/
+  template <typename F>
+  StreamingStatistics<T>& run(F&& simulate)
+  {
+    const std::vector<std::vector<T>> points   = _uq.getSamplingPoints();
+    const long                        nSamples = points.size();
+    std::size_t                       nLocalSamples {};
+
+    _statistics.reset();
+
+#ifdef PARALLEL_MODE_MPI
+    int parentRank {};
+    MPI_Comm_rank(_parentComm, &parentRank);
+
+    // Shared sample counter located on the first process
+    long*   counter {};
+    MPI_Win counterWin;
+    MPI_Win_allocate(parentRank == 0 ? sizeof(long) : 0, sizeof(long), MPI_INFO_NULL, _parentComm, &counter,
+                     &counterWin);
+    if (parentRank == 0) {
+      MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, counterWin);
+      *counter = 0;
+      MPI_Win_unlock(0, counterWin);
+    }
+    MPI_Barrier(_parentComm);
+
+    singleton::mpi().setCommunicator(_groupComm);
+    const bool groupLeader = singleton::mpi().isMainProcessor();
+    while (true) {
+      long iSample {};
+      if (groupLeader) {
+        const long increment = 1;
+        MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, counterWin);
+        MPI_Fetch_and_op(&increment, &iSample, MPI_LONG, 0, 0, MPI_SUM, counterWin);
+        MPI_Win_unlock(0, counterWin);
+      }
+      MPI_Bcast(&iSample, 1, MPI_LONG, 0, _groupComm);
+      if (iSample >= nSamples) {
+        break;
+      }
+      const std::vector<T> qoi = simulate(static_cast<std::size_t>(iSample), points[iSample]);
+      if (groupLeader) {
+        _statistics.add(iSample, qoi);
+      }
+      ++nLocalSamples;
+    }
+    singleton::mpi().setCommunicator(_parentComm);
+    MPI_Win_free(&counterWin);
+
+    clout << "Group " << _iGroup << " finished " << nLocalSamples << " samples" << std::endl;
+
+    // Combine partial statistics, processes without own contributions provide zero moments
+    int nQoI = _statistics.size();
+    singleton::mpi().reduceAndBcast(nQoI, MPI_MAX, 0, _parentComm);
+    _statistics.resize(nQoI);
+    const std::size_t momentsSize = _uq.getMomentsSize();
+    std::vector<T>    localMoments(nQoI * momentsSize);
+    for (int iQoI = 0; iQoI < nQoI; ++iQoI) {
+      const auto& moments = _statistics.getMoments(iQoI);
+      std::copy(moments.begin(), moments.end(), localMoments.begin() + iQoI * momentsSize);
+    }
+    int parentSize {};
+    MPI_Comm_size(_parentComm, &parentSize);
+    std::vector<T> allMoments(parentSize * localMoments.size());
+    singleton::mpi().allGather(localMoments.data(), localMoments.size(), allMoments.data(), localMoments.size(),
+                               _parentComm);
+
+    _statistics.reset(nQoI);
+    for (int iRank = 0; iRank < parentSize; ++iRank) {
+      for (int iQoI = 0; iQoI < nQoI; ++iQoI) {
+        auto begin = allMoments.begin() + (iRank * nQoI + iQoI) * momentsSize;
+        _statistics.merge(iQoI, std::vector<T>(begin, begin + momentsSize));
+      }
+    }
+#else
+    for (long iSample = 0; iSample < nSamples; ++iSample) {
+      _statistics.add(iSample, simulate(static_cast<std::size_t>(iSample), points[iSample]));
+      ++nLocalSamples;
+    }
+#endif
+
+    return _statistics;
+  }
+
+  StreamingStatistics<T>& getStatistics()
+  {
+    return _statistics;
+  }
+};
+
+} // namespace uq
+
+} // namespace olb
+
+#endif
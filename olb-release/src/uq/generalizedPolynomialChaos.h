@@ -67,6 +67,8 @@ public:
   // Transformation functions
   void chaosToRandom(const std::vector<T>& chaosCoefficients, std::vector<T>& randomVariables);
   void randomToChaos(const std::vector<T>& randomVariables, std::vector<T>& chaosCoefficients);
+  // Add contribution of the k-th quadrature point to chaos coefficients (streaming randomToChaos)
+  void addToChaos(std::size_t k, T randomVariable, std::vector<T>& chaosCoefficients);
 
   // Chaos operations
   void chaosProduct(const std::vector<T>& chaos1, const std::vector<T>& chaos2, std::vector<T>& product);
@@ -370,6 +370,17 @@ void GeneralizedPolynomialChaos<T>::randomToChaos(const std::vector<T>& randomVa
   }
 }
 
+template <typename T>
+void GeneralizedPolynomialChaos<T>::addToChaos(std::size_t k, T randomVariable, std::vector<T>& chaosCoefficients)
+{
+  chaosCoefficients.resize(No, 0.0);
+
+  const T weightedRandomVariable = weightsMultiplied[k] * randomVariable;
+  for (std::size_t i = 0; i < No; ++i) {
+    chaosCoefficients[i] += weightedRandomVariable * phiRan[k * No + i] * t2Product_inv[i];
+  }
+}
+
 // Chaos operations
 template <typename T>
 void GeneralizedPolynomialChaos<T>::chaosProduct(const std::vector<T>& chaos1, const std::vector<T>& chaos2,
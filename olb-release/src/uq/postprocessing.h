@@ -305,6 +305,79 @@ void computeMeanAndStdAndWriteVTI(UncertaintyQuantification<T>& uq, const std::s
   } // end for (iter)
 }
 
+/**
+  * \brief Streaming mean and std dev of scalar quantities of interest
+  *
+  * Samples are accumulated as soon as they are available, in arbitrary order,
+  * without storing the per-sample results. Partial statistics of disjoint
+  * sample sets (e.g. of different process groups) are combined via merge.
+  */
+template <typename T>
+class StreamingStatistics {
+private:
+  UncertaintyQuantification<T>& _uq;
+  // _moments[iQoI][iMoment]
+  std::vector<std::vector<T>> _moments;
+
+public:
+  StreamingStatistics(UncertaintyQuantification<T>& uq, std::size_t nQoI = 0)
+    : _uq(uq)
+  {
+    resize(nQoI);
+  }
+
+  void resize(std::size_t nQoI)
+  {
+    _moments.resize(nQoI, std::vector<T>(_uq.getMomentsSize(), 0.0));
+  }
+
+  void reset(std::size_t nQoI = 0)
+  {
+    _moments.clear();
+    resize(nQoI);
+  }
+
+  std::size_t size() const
+  {
+    return _moments.size();
+  }
+
+  /// Add QoIs evaluated for sample iSample
+  void add(std::size_t iSample, const std::vector<T>& qoi)
+  {
+    if (qoi.size() > size()) {
+      resize(qoi.size());
+    }
+    for (std::size_t iQoI = 0; iQoI < qoi.size(); ++iQoI) {
+      _uq.addToMoments(iSample, qoi[iQoI], _moments[iQoI]);
+    }
+  }
+
+  /// Merge moments of QoI iQoI accumulated on a disjoint set of samples
+  void merge(std::size_t iQoI, const std::vector<T>& moments)
+  {
+    if (iQoI >= size()) {
+      resize(iQoI + 1);
+    }
+    _uq.mergeMoments(moments, _moments[iQoI]);
+  }
+
+  const std::vector<T>& getMoments(std::size_t iQoI) const
+  {
+    return _moments[iQoI];
+  }
+
+  T mean(std::size_t iQoI)
+  {
+    return _uq.meanFromMoments(_moments[iQoI]);
+  }
+
+  T std(std::size_t iQoI)
+  {
+    return _uq.stdFromMoments(_moments[iQoI]);
+  }
+};
+
 } // namespace uq
 
 } // namespace olb
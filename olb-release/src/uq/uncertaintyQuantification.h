@@ -92,6 +92,13 @@ public:
   T mean(const std::vector<T>& samples);
   T std(const std::vector<T>& samples);
 
+  // Streaming statistical moments (samples may be added in arbitrary order)
+  std::size_t getMomentsSize();
+  void        addToMoments(std::size_t iSample, T sample, std::vector<T>& moments);
+  void        mergeMoments(const std::vector<T>& other, std::vector<T>& moments);
+  T           meanFromMoments(const std::vector<T>& moments);
+  T           stdFromMoments(const std::vector<T>& moments);
+
   // Other methods common to all UQ methods
   // ...
 
@@ -323,6 +323,71 @@ T UncertaintyQuantification<T>::std(const std::vector<T>& input)
   return std;
 }
 
+// Streaming moments are the chaos coefficients for GPC and (count, mean, M2)
+// following Welford for all sampling based methods
+template <typename T>
+std::size_t UncertaintyQuantification<T>::getMomentsSize()
+{
+  if (uqMethod == UQMethod::GPC) {
+    if (!ops) {
+      throw std::runtime_error("GPC has not been initialized. Call initializeGPC() first.");
+    }
+    return No;
+  }
+  return 3;
+}
+
+template <typename T>
+void UncertaintyQuantification<T>::addToMoments(std::size_t iSample, T sample, std::vector<T>& moments)
+{
+  moments.resize(getMomentsSize(), 0.0);
+  if (uqMethod == UQMethod::GPC) {
+    ops->addToChaos(iSample, sample, moments);
+  }
+  else {
+    moments[0] += 1;
+    const T delta = sample - moments[1];
+    moments[1] += delta / moments[0];
+    moments[2] += delta * (sample - moments[1]);
+  }
+}
+
+template <typename T>
+void UncertaintyQuantification<T>::mergeMoments(const std::vector<T>& other, std::vector<T>& moments)
+{
+  moments.resize(getMomentsSize(), 0.0);
+  if (uqMethod == UQMethod::GPC) {
+    for (std::size_t i = 0; i < No; ++i) {
+      moments[i] += other[i];
+    }
+  }
+  else if (other[0] > 0) {
+    const T count = moments[0] + other[0];
+    const T delta = other[1] - moments[1];
+    moments[1] += delta * other[0] / count;
+    moments[2] += other[2] + delta * delta * moments[0] * other[0] / count;
+    moments[0] = count;
+  }
+}
+
+template <typename T>
+T UncertaintyQuantification<T>::meanFromMoments(const std::vector<T>& moments)
+{
+  if (uqMethod == UQMethod::GPC) {
+    return ops->mean(moments);
+  }
+  return moments[1];
+}
+
+template <typename T>
+T UncertaintyQuantification<T>::stdFromMoments(const std::vector<T>& moments)
+{
+  if (uqMethod == UQMethod::GPC) {
+    return ops->std(moments);
+  }
+  return std::sqrt(moments[2] / (moments[0] - 1));
+}
+
 } // namespace uq
 
 } // namespace olb
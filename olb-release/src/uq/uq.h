@@ -31,6 +31,7 @@
 #include "monteCarlo.h"
 #include "polynomial.h"
 #include "postprocessing.h"
+#include "ensembleRunner.h"
 #include "quasiMonteCarlo.h"
 #include "uncertaintyQuantification.h"
 #include "filesIO.h"
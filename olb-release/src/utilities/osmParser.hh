@@ -536,6 +536,9 @@ void OSMParser<T>::createGeometry(olb::SuperGeometry<T, 3>& superGeometry,TYPE t
   {
     _prevWriteIncrementalState= false;
   }
+  // Indicators need to stay alive until the deferred renames are committed
+  std::vector<std::unique_ptr<IndicatorF3D<T>>> indicators;
+  superGeometry.beginEdit();
   if(type==TYPE::BUILDING)
   {
     for (const auto& building : buildings) {
@@ -545,7 +548,7 @@ void OSMParser<T>::createGeometry(olb::SuperGeometry<T, 3>& superGeometry,TYPE t
         height = (building.height == 0) ? 8 : building.height;
         points.push_back({node.lat, node.lon, height, 0});
       }
-      IndicatorPolygon3D<T> polygon(points);
+      auto& polygon = *indicators.emplace_back(new IndicatorPolygon3D<T>(points));
       superGeometry.rename(matF, matTo, polygon);
     }
   }
@@ -564,9 +567,9 @@ void OSMParser<T>::createGeometry(olb::SuperGeometry<T, 3>& superGeometry,TYPE t
 
         Vector<T, 3> posSphere({tree.position.lat, tree.position.lon, height});
 
-        IndicatorCylinder3D<T> trunk(pos, {0, 0, 1}, radiusTrunk, height);
+        auto& trunk = *indicators.emplace_back(new IndicatorCylinder3D<T>(pos, {0, 0, 1}, radiusTrunk, height));
         //IndicatorSphere3D<T> crown(posSphere, radiusCrown);
-        IndicatorCylinder3D<T> crown(pos2,{0,0,1},radiusCrown,height);
+        auto& crown = *indicators.emplace_back(new IndicatorCylinder3D<T>(pos2,{0,0,1},radiusCrown,height));
 
         superGeometry.rename(matF, matTo, trunk);
         superGeometry.rename(matF, matTo, crown);
@@ -580,8 +583,8 @@ void OSMParser<T>::createGeometry(olb::SuperGeometry<T, 3>& superGeometry,TYPE t
           height = (vegitation.height == 0) ? 8 : vegitation.height;
           points.push_back({node.lat, node.lon, height, -1.});
         }
-        IndicatorPolygon3D<T> polygon(points);
-        IndicatorTranslate3D<T> transPolygon({0,0,-1},polygon);
+        auto& polygon = *indicators.emplace_back(new IndicatorPolygon3D<T>(points));
+        auto& transPolygon = *indicators.emplace_back(new IndicatorTranslate3D<T>({0,0,-1},polygon));
         superGeometry.rename(matF, matTo, transPolygon);
         superGeometry.rename(5, matTo, transPolygon);
       }
@@ -625,8 +628,8 @@ void OSMParser<T>::createGeometry(olb::SuperGeometry<T, 3>& superGeometry,TYPE t
           vector<Vector<T, 4>> fullPolygon = leftSide;
           fullPolygon.insert(fullPolygon.end(), rightSide.rbegin(), rightSide.rend());
 
-          IndicatorPolygon3D<T> polygon(fullPolygon);
-          IndicatorTranslate3D<T> transPolygon({0,0,-1*physDeltaX},polygon);
+          auto& polygon = *indicators.emplace_back(new IndicatorPolygon3D<T>(fullPolygon));
+          auto& transPolygon = *indicators.emplace_back(new IndicatorTranslate3D<T>({0,0,-1*physDeltaX},polygon));
           //superGeometry.rename(matF, matTo,1, transPolygon);
           superGeometry.rename(matF, matTo, transPolygon);
         }
@@ -635,6 +638,7 @@ void OSMParser<T>::createGeometry(olb::SuperGeometry<T, 3>& superGeometry,TYPE t
       }
     }
   }
+  superGeometry.commit();
   if(_prevWriteIncrementalState){
     superGeometry.setWriteIncrementalVTK(true);
   }